@@ -76,12 +76,29 @@ namespace gum{
         const CausalModel<GUM_SCALAR>& cm() const; 
         const ASTtree<GUM_SCALAR>& root() const;
 
+        /**
+         * @brief Returns the canonical fingerprint of the causal model of the 
+         * formula (see @ref CausalModel::fingerprint), to key the caches of 
+         * the formulas computed on structurally identical models
+         */
+        uint64_t fingerprint() const;
+
         /**
          * @brief Compute the Potential from the CausalFormula over vars using cond as value for others variables
          *
         * @return Potential The resulting distribution
         */
         Potential<GUM_SCALAR> eval() const;
+
+        /**
+         * @brief Compute the Potential from the CausalFormula in another 
+         * observational network over the same variables (the one of a 
+         * @ref CausalModelVariant for instance)
+         *
+         * @param bn the observational network
+         * @return Potential The resulting distribution
+         */
+        Potential<GUM_SCALAR> eval(const IBayesNet<GUM_SCALAR>& bn) const;
     };
 }
 
@@ -34,8 +34,18 @@ namespace gum{
         return _root_;
     }
 
+    template<typename GUM_SCALAR>
+    uint64_t CausalFormula<GUM_SCALAR>::fingerprint() const {
+        return _cm_.fingerprint();
+    }
+
     template<typename GUM_SCALAR>
     Potential<GUM_SCALAR> CausalFormula<GUM_SCALAR>::eval() const{
         return root().eval(cm().observationalBN());
     }
+
+    template<typename GUM_SCALAR>
+    Potential<GUM_SCALAR> CausalFormula<GUM_SCALAR>::eval(const IBayesNet<GUM_SCALAR>& bn) const{
+        return root().eval(bn);
+    }
 }
@@ -8,6 +8,7 @@
 #include "CausalModel.h"
 #include "CausalFormula.h"
 #include "doCalculus.h"
+#include "causalModelVariant.h"
 #include "agrum/tools/core/set.h"
 #include "agrum/tools/core/hashTable.h"
 #include <agrum/tools/multidim/potential.h>
@@ -90,17 +91,18 @@ namespace gum{
      * (parentless nodes - whatif-latent variables) in the BN with which we created 
      * the causal model with "profile" as evidence. 
      * 
-     *     -Step 2 : We replace in the original BN the prior probabilities of 
-     * idiosyncratic nodes with potentials calculated in step 1 (it will spread to
-     * the causal model) This function returns the twin CausalModel.
+     *     -Step 2 : We replace the prior probabilities of idiosyncratic nodes 
+     * with potentials calculated in step 1, in a variant of the causal model 
+     * (the original BN is not modified). This function returns the twin 
+     * variant, which only stores the replaced tables.
      *
      * @param cm CausalModel
      * @param profile evidence
      * @param whatif idiosyncratic nodes
-     * @return CausalModel the twin CausalModel
+     * @return CausalModelVariant the twin model
      */ 
     template<typename GUM_SCALAR>
-    CausalModel<GUM_SCALAR> counterfactualModel(
+    CausalModelVariant<GUM_SCALAR> counterfactualModel(
         const CausalModel<GUM_SCALAR>& cm, 
         const HashTable<std::string, NodeId>& profile, 
         const NameSet& whatif
@@ -45,18 +45,18 @@ namespace gum{
         const NameSet& knowing        
     ) {
         auto id_on = NodeSet();
-        for(const auto& x : on) id_on.insert(x);
+        for(const auto& x : on) id_on.insert(cm.idFromName(x));
         auto id_doing = NodeSet();
-        for(const auto& x : doing) id_doing.insert(x);
+        for(const auto& x : doing) id_doing.insert(cm.idFromName(x));
         auto id_knowing = NodeSet();
-        for(const auto& x : knowing) id_knowing.insert(x);
+        for(const auto& x : knowing) id_knowing.insert(cm.idFromName(x));
         
         std::string explain = "";
         CausalFormula<GUM_SCALAR> ar;
 
         if(isDSep(cm, id_doing, id_on, id_knowing + cm.latentVariablesIds())){
             ar = CausalFormula(cm, ASTPosteriorProba(
-                cm.causalBN(), on, knowing), on, doing, knowing);
+                cm.observationalBN(), on, knowing), on, doing, knowing);
 
             explain = "No causal effect of X on Y, because they are d-separated ";
             explain += "(conditioning on the observed variables if any).";
@@ -68,13 +68,35 @@ namespace gum{
                 ar = CausalFormula(cm, getBackDoorTree(
                     cm, *doing.begin(), *on.begin(), bd.value), on, doing, knowing);
                 explain = "backdoor ";
-                for(const auto& i : bd.value) explain += cm.causalBN().variable(i).name();
+                for(const auto& i : bd.value) explain += cm.variable(i).name();
                 explain += " found.";
             }else if(auto fd = cm.frontDoor(*id_doing.begin(), *id_on.begin())){
                 ar = CausalFormula(cm, getFrontDoorTree(
                     cm, *doing.begin(), *on.begin(), fd), on, doing, knowing);
                 explain = "frontdoor ";
-                for(const auto& i : fd.value) explain += cm.causalBN().variable(i).name();
+                for(const auto& i : fd.value) explain += cm.variable(i).name();
+                explain += " found.";
+            }
+        }
+
+        // conditional frontdoor
+        if(explain == "" && id_doing.size() == 1 && on.size() == 1 && knowing.size() != 0){
+            if(auto fd = cm.frontDoor(*id_doing.begin(), *id_on.begin(), id_knowing)){
+                ar = CausalFormula(cm, getFrontDoorTree(
+                    cm, *doing.begin(), *on.begin(), fd.value(), knowing), on, doing, knowing);
+                explain = "conditional frontdoor ";
+                for(const auto& i : fd.value()) explain += cm.variable(i).name();
+                explain += " found.";
+            }
+        }
+
+        // generalized adjustment, for any number of causes and effects
+        if(explain == "" && knowing.size() == 0){
+            if(auto zset = cm.adjustment(id_doing, id_on)){
+                ar = CausalFormula(cm, getAdjustmentTree(
+                    cm, doing, on, zset.value()), on, doing, knowing);
+                explain = "adjustment set ";
+                for(const auto& i : zset.value()) explain += cm.variable(i).name();
                 explain += " found.";
             }
         }
@@ -104,7 +126,7 @@ namespace gum{
     }
 
     template<typename GUM_SCALAR>
-    CausalModel<GUM_SCALAR> counterfactualModel(
+    CausalModelVariant<GUM_SCALAR> counterfactualModel(
         const CausalModel<GUM_SCALAR>& cm, 
         const HashTable<std::string, NodeId>& profile, 
         const NameSet& whatif
@@ -126,18 +148,13 @@ namespace gum{
         // parentless - (whatif+latent variables)
         auto idiosyncratic = (orphans - id_whatif) - cm.latentVariablesIds();
 
-        CausalModel ret = cm;
-        auto& bn = ret.observationalBN();
-
-        auto posteriors = HashTable<NodeId, Potential<GUM_SCALAR>>(); 
-        auto ie = LazyPropagation(bn);
-        ie.setEvidence(profile);
+        // Step 2 : the twin only stores the tables of the idiosyncratic factors
+        auto ret = CausalModelVariant<GUM_SCALAR>(cm);
+        auto ie = LazyPropagation<GUM_SCALAR>(&cm.observationalBN());
+        for(const auto& e : profile) ie.addEvidence(e.first, e.second);
         ie.makeInference();
         for(const auto& factor : idiosyncratic)
-            posteriors[factor] = ie.posterior(factor);
-
-        for(const auto& factor : idiosyncratic)
-            bn.cpt(factor).fillWith(posteriors[factor]);
+            ret.override(factor, ie.posterior(factor));
         
         return ret;
     }
@@ -153,14 +170,19 @@ namespace gum{
         // step 1 and 2 : create the twin causal model
         auto twin = counterfactualModel(cm, profile, whatif);
 
-        // step 3 : operate the intervention in the causal model based on bn
-        Potential<GUM_SCALAR> adj = causalImpact(twin, on, whatif, NameSet(), values)[1];
-
-        // adj is using variables from twin. We copy it in a Potential using variables of cm
-        Potential<GUM_SCALAR> res;
-        for(const auto& v : adj.value.names)
-            res.add(cm.observationalBN().variableFromName(v));
-        res.fillWith(adj);
-        return res;
+        // step 3 : operate the intervention in the twin : it has the structure 
+        // of cm, so the formula is the one of cm, evaluated through the overlay
+        auto adj = doCalculus(cm, on, whatif).eval(twin.observationalBN());
+
+        // the twin shares the variables of cm
+        auto inst = Instantiation();
+        for(const auto& t : values){
+            const auto& v = cm.observationalBN().variableFromName(t.first);
+            if(!adj.contains(v)) continue;
+            inst.add(v);
+            inst.chgVal(v, t.second);
+        }
+        if(inst.nbrDim() == 0) return adj;
+        return adj.extract(inst);
     }   
 }
\ No newline at end of file
@@ -9,13 +9,29 @@
 #include <agrum/tools/core/set.h>
 #include <agrum/tools/core/hashTable.h>
 #include <agrum/tools/graphicalModels/DAGmodel.h>
+#include <agrum/tools/graphicalModels/variableNodeMap.h>
 #include <doorCriteria.h>
+#include "symbolTable.h"
+#include "districtIndex.h"
+#include "fingerprint.h"
 #include <utility>
 #include <string>
 #include <optional>
+#include <memory>
+#include <mutex>
 
 namespace gum{
 
+   /**
+    * @brief The dependency footprint of a query on a @ref CausalModel : the 
+    * ancestral set of the nodes it involves, and the clock of the model when 
+    * it was recorded (see @ref CausalModel::footprint)
+    */
+   struct CausalFootprint {
+      gum::NodeSet nodes; ///< the nodes whose parents the query depends on
+      uint64_t stamp;     ///< the clock of the model at the recording
+   };
+
    /**
       * @class CausalModel
       * @brief Class representing a Causal Model.
@@ -31,6 +47,11 @@ namespace gum{
       * @param keepArcs By default, the arcs between variables affected by a 
       * common latent variable will be removed but this can be avoided by setting 
       * ``keepArcs`` to ``True``
+      *
+      * The causal model is purely structural: its graph is the DAG of the 
+      * DAGmodel and its variables are kept in a VariableNodeMap, so no 
+      * conditional probability table is ever allocated for it (the causal 
+      * BN is only built on demand, see @ref causalBN).
       * @author Kacper Ozieblowski
       */
    template <typename GUM_SCALAR>
@@ -39,9 +60,36 @@ namespace gum{
       const gum::BayesNet<GUM_SCALAR>& _ob_BN_; ///< observational bayes net
       // self.__latentVarsDescriptor = latentVarsDescriptor
       bool _keepArcs_;
-      gum::BayesNet<GUM_SCALAR> _ca_BN_; ///< causal bayes net
+      gum::VariableNodeMap _varMap_; ///< variables of the causal graph (latent ones included), whose structure is dag_
       gum::NodeSet _lat_ ;
       gum::HashTable<gum::NodeId, std::string> _names_;
+      mutable std::shared_ptr<gum::BayesNet<GUM_SCALAR>> _ca_BN_; ///< causal bayes net, built by causalBN() only
+      mutable std::unique_ptr<std::once_flag> _caOnce_;          ///< guards the build of _ca_BN_, renewed when it is dropped
+      SymbolTable _symbols_;              ///< the names of the variables, frozen once the model is built
+      std::vector<gum::NodeId> _symbolNodes_; ///< the node of each symbol
+      std::vector<Symbol> _nodeSymbols_;  ///< the symbol of each node id, SymbolTable::none if none
+
+      DistrictIndex _districts_;          ///< the c-components of the observed nodes
+      uint64_t _fingerprint_;             ///< the canonical fingerprint, maintained through the edits
+      gum::HashTable<gum::NodeId, std::pair<uint64_t, Size>> _latentChildren_; ///< children sum and count of each latent (see fingerprint_latent)
+
+      uint64_t _clock_;                   ///< number of edits of the structure
+      std::vector<uint64_t> _versions_;   ///< clock of the last edit of the parents of each node id
+
+      /// records an edit of the parents of ``n``
+      void _touch_(gum::NodeId n);
+
+      /// updates the fingerprint for the arc ``a -> b`` being added or erased
+      void _fingerprintArc_(gum::NodeId a, gum::NodeId b, bool added);
+
+      /// interns the name of the node ``id``
+      void _addSymbol_(gum::NodeId id, const std::string& name);
+
+      /// recomputes the c-components, after a latent variable lost a child
+      void _rebuildDistricts_();
+
+      /// drops the causal BN built from a previous structure
+      void _invalidate_();
 
    public: 
       CausalModel(const gum::BayesNet<GUM_SCALAR>& bn,
@@ -71,8 +119,24 @@ namespace gum{
        * @param keepArcs do we keep (or not) the arc between the children ?
        */
       void addLatentVariable(const std::string& name, const std::vector<gum::NodeId>& lchild, bool keepArcs = false);
+
+      /**
+       * @brief Add a variable added to the observational network after the 
+       * model was built, with its arcs from the nodes of the model (the 
+       * parents must be added first)
+       * 
+       * @param id the node of the observational network, not used by a 
+       * latent variable of the model
+       * @throw NotFound if ``id`` is not a node of the observational network
+       * @throw DuplicateElement if ``id`` is already a node of the model
+       */
+      void addObservedVariable(gum::NodeId id);
       /**
+       * @brief Returns the causal graph as a Bayesian network. It is built (with its 
+       * tables) at the first call after a change of the structure: prefer @ref dag, 
+       * @ref variable and the graph methods of the model, which allocate nothing.
        * @warning do not infer any computations in this model. It is strictly a structural model
+       * The build is thread-safe : concurrent first calls build it once.
        * @return const gum::BayesNet<GUM_SCALAR>& 
        */
       const gum::BayesNet<GUM_SCALAR>& causalBN() const;
@@ -120,9 +184,52 @@ namespace gum{
       /**
        * @param name 
        * @return gum::NodeId 
+       * @throw NotFound if no variable has this name
        */
       gum::NodeId idFromName(const std::string& name) const;
 
+      /**
+       * @brief Returns the interned names of the variables : the symbols are 
+       * dense ids, and the lookups use a perfect hash once the model is built.
+       * 
+       * @return const SymbolTable& 
+       */
+      const SymbolTable& symbols() const;
+
+      /**
+       * @brief Freezes the names of the variables added by @ref addObservedVariable 
+       * since the model was built, so that their lookups use the perfect hash again
+       */
+      void freezeSymbols();
+
+      /**
+       * @param id a node of the model
+       * @return Symbol the symbol of its name
+       * @throw NotFound if ``id`` is not a node of the model
+       */
+      Symbol symbol(gum::NodeId id) const;
+
+      /**
+       * @param name the name of a variable
+       * @return Symbol its symbol
+       * @throw NotFound if no variable has this name
+       */
+      Symbol symbolFromName(std::string_view name) const;
+
+      /**
+       * @param s a symbol of the model
+       * @return gum::NodeId the node named by ``s``
+       * @throw NotFound if ``s`` is not a symbol of the model
+       */
+      gum::NodeId idFromSymbol(Symbol s) const;
+
+      /**
+       * @param s a symbol of the model
+       * @return std::string_view the name of ``s`` (valid as long as the model)
+       * @throw NotFound if ``s`` is not a symbol of the model
+       */
+      std::string_view name(Symbol s) const;
+
       /**
        * @brief Returns the set of ids of latent variables in the causal model.
        * 
@@ -130,6 +237,64 @@ namespace gum{
        */
       const gum::NodeSet& latentVariablesIds() const;
 
+      /**
+       * @brief Returns the partition of the observed nodes into c-components,
+       * maintained through the edits of the model
+       * 
+       * @return const DistrictIndex& 
+       */
+      const DistrictIndex& districts() const;
+
+      /**
+       * @return std::vector<gum::NodeSet> the c-components of the observed nodes
+       */
+      std::vector<gum::NodeSet> cComponents() const;
+
+      /**
+       * @brief Returns the canonical fingerprint of the model : a hash of the 
+       * names of the observed nodes, of the arcs between them and of the 
+       * children sets of the latent variables confounding at least two of 
+       * them (see @ref fingerprint_node). It does not depend on the node ids 
+       * nor on the names of the latent variables, so structurally identical 
+       * models (or views, see @ref canonical_fingerprint) share it.
+       * 
+       * @return uint64_t maintained through the edits, O(1)
+       */
+      uint64_t fingerprint() const;
+
+      /**
+       * @brief Returns the clock of the model, incremented by each edit of 
+       * the structure (an arc added or erased, a latent variable added)
+       */
+      uint64_t clock() const;
+
+      /**
+       * @brief Returns the version of the node : the clock of the last edit 
+       * of its parents (0 if they never changed)
+       * 
+       * @param id a node of the model
+       * @throw NotFound if ``id`` is not a node of the model
+       */
+      uint64_t version(gum::NodeId id) const;
+
+      /**
+       * @brief Records the dependency footprint of a query involving the 
+       * nodes of ``seeds`` : their ancestral set (latent ancestors included). 
+       * The identification, the d-separation and the adjustment criteria 
+       * only depend on the parents of the nodes of this set, so a result 
+       * stays valid as long as no edit touches it (see @ref isUpToDate).
+       * 
+       * @param seeds the nodes of the query
+       * @return CausalFootprint
+       */
+      CausalFootprint footprint(const gum::NodeSet& seeds) const;
+
+      /**
+       * @brief Whether no edit touched the footprint since it was recorded, 
+       * in O(|footprint|)
+       */
+      bool isUpToDate(const CausalFootprint& fp) const;
+
       /**
        * @brief Erase the arc a->b
        * 
@@ -183,7 +348,7 @@ namespace gum{
        * 
        * @return const gum::NodeGraphPart& 
        */
-      decltype(CausalModel<GUM_SCALAR>::_ca_BN_.nodes()) nodes() const ;
+      const gum::NodeGraphPart& nodes() const ;
 
       /**
        * @brief Return the set of arcs.
@@ -250,6 +415,18 @@ namespace gum{
        */
       std::optional<gum::NodeSet> backDoor(gum::NodeId cause, gum::NodeId effect);
 
+      /**
+       * @brief Check if a backdoor satisfying `constraints` exists between `cause` and `effect`.
+       * The latent variables are always forbidden. The constraints are used to prune the search, 
+       * which stops at once when no such backdoor exists.
+       *
+       * @param cause the nodeId of the cause
+       * @param effect the nodeId of the effect
+       * @param constraints the required, forbidden and allowed nodes and the maximal size
+       * @return nullopt if not found backdoor. Otherwise return the found backdoors as set of ids.
+       */
+      std::optional<gum::NodeSet> backDoor(gum::NodeId cause, gum::NodeId effect, const BackdoorConstraints& constraints) const;
+
       /**
        * @brief Check if a backdoor exists between `cause` and `effect`
        *
@@ -304,6 +481,29 @@ namespace gum{
        * @return nullopt if not found frontdoor. Otherwise return the found frontdoors as set of names.
        */
       std::optional<std::set<std::string>> frontDoor_withNames(gum::NodeId cause, gum::NodeId effect);
+
+      /**
+       * @brief Check if a conditional frontdoor exists between `cause` and `effect` 
+       * given the observed nodes `knowing`
+       *
+       * @param cause the nodeId of the cause
+       * @param effect the nodeId of the effect
+       * @param knowing the nodeIds of the observations
+       * @return nullopt if not found frontdoor. Otherwise return the found frontdoors as set of ids.
+       */
+      std::optional<gum::NodeSet> frontDoor(gum::NodeId cause, gum::NodeId effect, const gum::NodeSet& knowing) const;
+
+      /**
+       * @brief Check if an adjustment set (generalized adjustment criterion) 
+       * exists between the sets of nodes `causes` and `effects`, the latent 
+       * variables being excluded
+       *
+       * @param causes the nodeIds of the causes
+       * @param effects the nodeIds of the effects
+       * @return nullopt if there is no adjustment set. Otherwise return an adjustment set 
+       * (from which no node can be removed) as set of ids.
+       */
+      std::optional<gum::NodeSet> adjustment(const gum::NodeSet& causes, const gum::NodeSet& effects) const;
    
       /// @name Variable manipulation methods.
       /// @{
@@ -423,6 +623,37 @@ namespace gum{
      */
    template<typename GUM_SCALAR>
    CausalModel<GUM_SCALAR> inducedCausalSubModel(const CausalModel<GUM_SCALAR>& cm);
+
+   /**
+     * @brief Whether the causal model is in the canonical semi-Markovian 
+     * form built by @ref latentProjection : every latent variable is a root 
+     * whose children are at least two observed nodes, and no two latent 
+     * variables have the same children.
+     *
+     * @param cm CausalModel : the causal model
+     * @return bool
+     */
+   template<typename GUM_SCALAR>
+   bool isSemiMarkovian(const CausalModel<GUM_SCALAR>& cm);
+
+   /**
+     * @brief Create the latent projection of a causal model : the causal 
+     * model over the same observed nodes in the canonical semi-Markovian form.
+     *
+     * A path ``a -> l1 -> ... -> b`` whose inner nodes are all latent becomes 
+     * the arc ``a -> b``, and the observed nodes reached from a latent root 
+     * through latent nodes only are the children of a single latent variable 
+     * (named after the root). The latent variables confounding less than two 
+     * observed nodes are dropped, and the ones with the same children are 
+     * merged. The projection has the same d-separations and c-components 
+     * over the observed nodes, hence the same identification results.
+     *
+     * @param cm CausalModel : the causal model
+     * @return CausalModel the projected model, sharing the observational 
+     * Bayesian network of ``cm``
+     */
+   template<typename GUM_SCALAR>
+   CausalModel<GUM_SCALAR> latentProjection(const CausalModel<GUM_SCALAR>& cm);
 }
 
 #include "CausalModel_tpl.h"
@@ -4,8 +4,12 @@
 #include <agrum/tools/graphs/parts/nodeGraphPart.h>
 #include <agrum/tools/core/set.h>
 #include <agrum/tools/core/hashTable.h>
+#include <agrum/tools/variables/labelizedVariable.h>
 #include <utility>
 #include <string>
+#include <vector>
+#include <set>
+#include <algorithm>
 
 #include "CausalModel.h"
 
@@ -15,28 +19,42 @@ namespace gum{
                const std::vector<std::pair<std::string, std::vector<gum::NodeId>>>& latentVarDescriptors,
                bool keepArcs
                )
-               : _ob_BN_(bn), _keepArcs_(keepArcs), _ca_BN_(), _lat_(), _names_()
+               : DAGmodel(), _ob_BN_(bn), _keepArcs_(keepArcs), _varMap_(), _lat_(), _names_(), _ca_BN_(nullptr),
+                 _caOnce_(std::make_unique<std::once_flag>()), _symbols_(), _symbolNodes_(), _nodeSymbols_(), _districts_(), 
+                 _fingerprint_(0), _latentChildren_(), _clock_(0), _versions_()
    {
       // we have to redefine attributes since the bn 
       // may be augmented by latent variables
 
-      // nodes and arcs of BN
-      for(const auto& n : bn.nodes()) _ca_BN_.add(bn.variable(n), n);
-      for(const auto& a : bn.arcs()) _ca_BN_.addArc(a.tail(), a.head());
-
-      for(const auto& nid : _ca_BN_.nodes()){
-         _names_.insert(nid, _ca_BN_.variable(nid).name());
+      // nodes and arcs of BN : the structure only, no table is copied
+      for(const auto& n : bn.nodes()){
+         dag_.addNodeWithId(n);
+         _varMap_.insert(n, bn.variable(n));
+         _names_.insert(n, bn.variable(n).name());
+         _addSymbol_(n, bn.variable(n).name());
+         _districts_.addNode(n);
+         _fingerprint_ += fingerprint_node(fingerprint_name(bn.variable(n).name()));
+      }
+      for(const auto& a : bn.arcs()){
+         dag_.addArc(a.tail(), a.head());
+         _fingerprintArc_(a.tail(), a.head(), true);
       }
 
       for(const auto& p : latentVarDescriptors)
          addLatentVariable(p.first, p.second, keepArcs);
+      _symbols_.freeze();
 
       GUM_CONSTRUCTOR(CausalModel);
    }
 
    template <typename GUM_SCALAR>
    CausalModel<GUM_SCALAR>::CausalModel(const CausalModel& ot)
-      : _ob_BN_(ot._ob_BN_), _keepArcs_(ot._keepArcs_), _ca_BN_(ot._ca_BN_), _lat_(ot._lat_), _names_(ot._names_)
+      : DAGmodel(ot), _ob_BN_(ot._ob_BN_), _keepArcs_(ot._keepArcs_), _varMap_(ot._varMap_), _lat_(ot._lat_), _names_(ot._names_), 
+        // not shared : ``ot`` may be building its causal BN in another thread
+        _ca_BN_(nullptr), _caOnce_(std::make_unique<std::once_flag>()),
+        _symbols_(ot._symbols_), _symbolNodes_(ot._symbolNodes_), _nodeSymbols_(ot._nodeSymbols_),
+        _districts_(ot._districts_), _fingerprint_(ot._fingerprint_), _latentChildren_(ot._latentChildren_),
+        _clock_(ot._clock_), _versions_(ot._versions_)
    {
       GUM_CONS_CPY(CausalModel);
    }
@@ -46,6 +64,69 @@ namespace gum{
       GUM_DESTRUCTOR(CausalModel);
    }
 
+   template <typename GUM_SCALAR>
+   void CausalModel<GUM_SCALAR>::_invalidate_(){
+      // a structural edit is never concurrent with the queries of the model
+      _ca_BN_.reset();
+      _caOnce_ = std::make_unique<std::once_flag>();
+   }
+
+   template <typename GUM_SCALAR>
+   void CausalModel<GUM_SCALAR>::_addSymbol_(gum::NodeId id, const std::string& name){
+      const auto s = _symbols_.intern(name);
+      if(_symbolNodes_.size() <= s) _symbolNodes_.resize(s + 1, 0);
+      _symbolNodes_[s] = id;
+      if(_nodeSymbols_.size() <= id) _nodeSymbols_.resize(id + 1, SymbolTable::none);
+      _nodeSymbols_[id] = s;
+   }
+
+   template <typename GUM_SCALAR>
+   void CausalModel<GUM_SCALAR>::_touch_(gum::NodeId n){
+      if(n >= _versions_.size()) _versions_.resize(n + 1, 0);
+      _versions_[n] = ++_clock_;
+   }
+
+   template <typename GUM_SCALAR>
+   void CausalModel<GUM_SCALAR>::_fingerprintArc_(gum::NodeId a, gum::NodeId b, bool added){
+      if(_lat_.contains(b)) return; // only the observed children count
+      const auto hb = fingerprint_name(_names_[b]);
+      if(!_lat_.contains(a)){
+         const auto t = fingerprint_arc(fingerprint_name(_names_[a]), hb);
+         if(added) _fingerprint_ += t;
+         else _fingerprint_ -= t;
+         return;
+      }
+      auto& lc = _latentChildren_[a];
+      _fingerprint_ -= fingerprint_latent(lc.first, lc.second);
+      if(added){
+         lc.first += fingerprint_child(hb);
+         lc.second++;
+      } else {
+         lc.first -= fingerprint_child(hb);
+         lc.second--;
+      }
+      _fingerprint_ += fingerprint_latent(lc.first, lc.second);
+   }
+
+   template <typename GUM_SCALAR>
+   void CausalModel<GUM_SCALAR>::_rebuildDistricts_(){
+      _districts_.clear();
+      for(const auto& n : dag_.nodes())
+         if(!_lat_.contains(n)) _districts_.addNode(n);
+      for(const auto& l : _lat_){
+         bool found = false;
+         gum::NodeId first = 0;
+         for(const auto& c : dag_.children(l)){
+            if(_lat_.contains(c)) continue;
+            if(found) _districts_.unite(first, c);
+            else {
+               first = c;
+               found = true;
+            }
+         }
+      }
+   }
+
    template <typename GUM_SCALAR>
    void CausalModel<GUM_SCALAR>::addLatentVariable(const std::string& name, const std::vector<std::string>& lchild, bool keepArcs){
       std::vector<gum::NodeId> ids(lchild.size());
@@ -56,26 +137,57 @@ namespace gum{
    template <typename GUM_SCALAR>
    void CausalModel<GUM_SCALAR>::addLatentVariable(const std::string& name, const std::vector<gum::NodeId>& lchild, bool keepArcs){
       // simplest variable to add : only 2 modalities for latent variables
-      const auto id_latent = _ca_BN_.add(name, 2);
+      const auto id_latent = dag_.nextNodeId();
+      _varMap_.insert(id_latent, gum::LabelizedVariable(name, name, 2)); // throws on a duplicate name
+      dag_.addNodeWithId(id_latent);
+      _invalidate_();
       _lat_.insert(id_latent);
+      _latentChildren_.insert(id_latent, std::make_pair(uint64_t(0), Size(0)));
+      _touch_(id_latent);
       _names_.insert(id_latent, name);
+      const bool frozen = _symbols_.frozen();
+      _addSymbol_(id_latent, name);
+      if(frozen) _symbols_.freeze(); // the model was already built
    
       for(const auto& item : lchild) addCausalArc(id_latent, item);
 
       if(keepArcs) return;
       for(size_t i=0; i<lchild.size(); i++){
          for(size_t j=i+1; j<lchild.size(); j++){
-            if(_ca_BN_.parents(lchild[j]).contains(lchild[i])) 
+            if(dag_.parents(lchild[j]).contains(lchild[i])) 
                eraseCausalArc(lchild[i], lchild[j]);
-            else if(_ca_BN_.parents(lchild[i]).contains(lchild[j])) 
+            else if(dag_.parents(lchild[i]).contains(lchild[j])) 
                eraseCausalArc(lchild[j], lchild[i]);
          }
       }
    }
 
+   template <typename GUM_SCALAR>
+   void CausalModel<GUM_SCALAR>::addObservedVariable(gum::NodeId id){
+      if(!_ob_BN_.exists(id)) GUM_ERROR(NotFound, "no node " << id << " in the observational BN")
+      if(dag_.exists(id)) GUM_ERROR(DuplicateElement, "node " << id << " is already in the causal model")
+      const auto& var = _ob_BN_.variable(id);
+      dag_.addNodeWithId(id);
+      _varMap_.insert(id, var);
+      _invalidate_();
+      _names_.insert(id, var.name());
+      _addSymbol_(id, var.name()); // the lookups fall back on a hash map until the next freeze
+      _districts_.addNode(id);
+      _fingerprint_ += fingerprint_node(fingerprint_name(var.name()));
+      _touch_(id);
+      for(const auto& p : _ob_BN_.parents(id))
+         if(dag_.exists(p)) addCausalArc(p, id);
+   }
+
    template <typename GUM_SCALAR>
    const gum::BayesNet<GUM_SCALAR>& CausalModel<GUM_SCALAR>::causalBN() const {
-      return _ca_BN_;
+      std::call_once(*_caOnce_, [this](){
+         auto bn = std::make_shared<gum::BayesNet<GUM_SCALAR>>();
+         for(const auto& n : dag_.nodes()) bn->add(_varMap_.get(n), n);
+         for(const auto& a : dag_.arcs()) bn->addArc(a.tail(), a.head());
+         _ca_BN_ = bn;
+      });
+      return *_ca_BN_;
    }
 
    template <typename GUM_SCALAR>
@@ -85,31 +197,33 @@ namespace gum{
 
    template <typename GUM_SCALAR>
    const gum::NodeSet& CausalModel<GUM_SCALAR>::parents(std::string name) const {
-      return parents(_ca_BN_.idFromName(name));
+      return parents(idFromName(name));
    }
 
    template <typename GUM_SCALAR>
    const gum::NodeSet& CausalModel<GUM_SCALAR>::parents(gum::NodeId id) const {
-      return _ca_BN_.parents(id);
+      return dag_.parents(id);
    }
 
    template <typename GUM_SCALAR>
    const gum::NodeSet& CausalModel<GUM_SCALAR>::children(std::string name) const {
-      return _ca_BN_.children(_ca_BN_.idFromName(name));
+      return dag_.children(idFromName(name));
    }
 
    template <typename GUM_SCALAR>
    const gum::NodeSet& CausalModel<GUM_SCALAR>::children(gum::NodeId id) const {
-      return _ca_BN_.children(id);
+      return dag_.children(id);
    }
 
    template <typename GUM_SCALAR>
    NodeSet CausalModel<GUM_SCALAR>::children(const NodeSet& ids) const{
-      return _ca_BN_.children(ids);
+      return dag_.children(ids);
    }
    template <typename GUM_SCALAR>
    NodeSet CausalModel<GUM_SCALAR>::children(const std::vector< std::string >& names) const{
-      return _ca_BN_.children(names);
+      auto ids = NodeSet();
+      for(const auto& name : names) ids.insert(idFromName(name));
+      return dag_.children(ids);
    }
 
    template <typename GUM_SCALAR>
@@ -119,7 +233,42 @@ namespace gum{
 
    template <typename GUM_SCALAR>
    gum::NodeId CausalModel<GUM_SCALAR>::idFromName(const std::string& name) const {
-      return _ca_BN_.idFromName(name);
+      return _symbolNodes_[symbolFromName(name)];
+   }
+
+   template <typename GUM_SCALAR>
+   const SymbolTable& CausalModel<GUM_SCALAR>::symbols() const {
+      return _symbols_;
+   }
+
+   template <typename GUM_SCALAR>
+   void CausalModel<GUM_SCALAR>::freezeSymbols(){
+      _symbols_.freeze();
+   }
+
+   template <typename GUM_SCALAR>
+   Symbol CausalModel<GUM_SCALAR>::symbol(gum::NodeId id) const {
+      if(id >= _nodeSymbols_.size() || _nodeSymbols_[id] == SymbolTable::none) 
+         GUM_ERROR(NotFound, "no node " << id << " in the causal model")
+      return _nodeSymbols_[id];
+   }
+
+   template <typename GUM_SCALAR>
+   Symbol CausalModel<GUM_SCALAR>::symbolFromName(std::string_view name) const {
+      const auto s = _symbols_.find(name);
+      if(s == SymbolTable::none) GUM_ERROR(NotFound, "no variable named " << name << " in the causal model")
+      return s;
+   }
+
+   template <typename GUM_SCALAR>
+   gum::NodeId CausalModel<GUM_SCALAR>::idFromSymbol(Symbol s) const {
+      if(s >= _symbolNodes_.size()) GUM_ERROR(NotFound, "no symbol " << s << " in the causal model")
+      return _symbolNodes_[s];
+   }
+
+   template <typename GUM_SCALAR>
+   std::string_view CausalModel<GUM_SCALAR>::name(Symbol s) const {
+      return _symbols_.name(s);
    }
 
    template <typename GUM_SCALAR>
@@ -127,64 +276,137 @@ namespace gum{
       return _lat_;
    }
 
+   template <typename GUM_SCALAR>
+   const DistrictIndex& CausalModel<GUM_SCALAR>::districts() const {
+      return _districts_;
+   }
+
+   template <typename GUM_SCALAR>
+   std::vector<gum::NodeSet> CausalModel<GUM_SCALAR>::cComponents() const {
+      return _districts_.districts();
+   }
+
+   template <typename GUM_SCALAR>
+   uint64_t CausalModel<GUM_SCALAR>::fingerprint() const {
+      return _fingerprint_;
+   }
+
+   template <typename GUM_SCALAR>
+   uint64_t CausalModel<GUM_SCALAR>::clock() const {
+      return _clock_;
+   }
+
+   template <typename GUM_SCALAR>
+   uint64_t CausalModel<GUM_SCALAR>::version(gum::NodeId id) const {
+      if(!dag_.exists(id)) GUM_ERROR(NotFound, "no node " << id << " in the causal model")
+      return id < _versions_.size() ? _versions_[id] : 0;
+   }
+
+   template <typename GUM_SCALAR>
+   CausalFootprint CausalModel<GUM_SCALAR>::footprint(const gum::NodeSet& seeds) const {
+      auto res = CausalFootprint{gum::NodeSet(), _clock_};
+      auto stack = std::vector<gum::NodeId>();
+      for(const auto& n : seeds){
+         if(!dag_.exists(n) || res.nodes.contains(n)) continue;
+         res.nodes.insert(n);
+         stack.push_back(n);
+      }
+      while(!stack.empty()){
+         const auto x = stack.back();
+         stack.pop_back();
+         for(const auto& p : dag_.parents(x)){
+            if(res.nodes.contains(p)) continue;
+            res.nodes.insert(p);
+            stack.push_back(p);
+         }
+      }
+      return res;
+   }
+
+   template <typename GUM_SCALAR>
+   bool CausalModel<GUM_SCALAR>::isUpToDate(const CausalFootprint& fp) const {
+      if(fp.stamp == _clock_) return true;
+      for(const auto& n : fp.nodes)
+         if(n < _versions_.size() && _versions_[n] > fp.stamp) return false;
+      return true;
+   }
+
    template <typename GUM_SCALAR>
    void CausalModel<GUM_SCALAR>::eraseCausalArc(gum::NodeId a, gum::NodeId b){
-      _ca_BN_.eraseArc(a, b);
+      const bool linked = dag_.existsArc(a, b);
+      dag_.eraseArc(gum::Arc(a, b));
+      _invalidate_();
+      if(!linked) return;
+      _touch_(b);
+      _fingerprintArc_(a, b, false);
+      if(_lat_.contains(a)) _rebuildDistricts_(); // a union cannot be undone
    }
 
    template <typename GUM_SCALAR>
    void CausalModel<GUM_SCALAR>::eraseCausalArc(const std::string& a, const std::string& b){
-      _ca_BN_.eraseArc(_ob_BN_.idFromName(a), _ob_BN_.idFromName(b));
+      eraseCausalArc(idFromName(a), idFromName(b));
    }
 
    template <typename GUM_SCALAR>
    void CausalModel<GUM_SCALAR>::addCausalArc(gum::NodeId a, gum::NodeId b){
-      _ca_BN_.addArc(a, b);
+      const bool linked = dag_.existsArc(a, b);
+      dag_.addArc(a, b);
+      _invalidate_();
+      if(linked) return;
+      _touch_(b);
+      _fingerprintArc_(a, b, true);
+      if(!_lat_.contains(a) || _lat_.contains(b)) return;
+      // b joins the c-component of the other children of the latent a
+      for(const auto& c : dag_.children(a)){
+         if(c == b || _lat_.contains(c)) continue;
+         _districts_.unite(c, b);
+         break;
+      }
    }
 
    template <typename GUM_SCALAR>
    void CausalModel<GUM_SCALAR>::addCausalArc(const std::string& a, const std::string& b){
-      _ca_BN_.addArc(_ob_BN_.idFromName(a), _ob_BN_.idFromName(b));
+      addCausalArc(idFromName(a), idFromName(b));
    }
 
    template <typename GUM_SCALAR>
    void CausalModel<GUM_SCALAR>::existsArc(gum::NodeId a, gum::NodeId b){
-      _ca_BN_.existsArc(a, b);
+      dag_.existsArc(a, b);
    }
 
    template<typename GUM_SCALAR>
    void CausalModel<GUM_SCALAR>::existsArc(const std::string& a, const std::string& b){
-      _ca_BN_.existsArc(_ob_BN_.idFromName(a), _ob_BN_.idFromName(b));
+      dag_.existsArc(idFromName(a), idFromName(b));
    }
 
    template<typename GUM_SCALAR>
-   decltype(CausalModel<GUM_SCALAR>::_ca_BN_.nodes()) CausalModel<GUM_SCALAR>::nodes() const {
-      return _ca_BN_.nodes();
+   const gum::NodeGraphPart& CausalModel<GUM_SCALAR>::nodes() const {
+      return dag_.nodes();
    }
 
    template<typename GUM_SCALAR>
    const gum::ArcSet& CausalModel<GUM_SCALAR>::arcs() const {
-      return _ca_BN_.arcs();
+      return dag_.arcs();
    }
 
    template<typename GUM_SCALAR>
    const gum::VariableNodeMap& CausalModel<GUM_SCALAR>::variableNodeMap() const {
-      return _ca_BN_.variableNodeMap();
+      return _varMap_;
    }
 
    template<typename GUM_SCALAR>
    const gum::DiscreteVariable& CausalModel<GUM_SCALAR>::variable(gum::NodeId x) const {
-      return _ca_BN_.variable(x);
+      return _varMap_.get(x);
    }
 
    template<typename GUM_SCALAR>
    gum::NodeId CausalModel<GUM_SCALAR>::nodeId(const gum::DiscreteVariable& x) const {
-      return _ca_BN_.nodeId(x);
+      return _varMap_.get(x);
    }
 
    template<typename GUM_SCALAR>
    const gum::DiscreteVariable& CausalModel<GUM_SCALAR>::variableFromName(const std::string& name) const{
-      return _ca_BN_.variableFromName(name);
+      return _varMap_.variableFromName(name);
    }
 
    template<typename GUM_SCALAR>
@@ -200,6 +422,16 @@ namespace gum{
       return std::nullopt;
    }
 
+   template<typename GUM_SCALAR>
+   std::optional<gum::NodeSet> CausalModel<GUM_SCALAR>::backDoor(gum::NodeId cause, gum::NodeId effect, const BackdoorConstraints& constraints) const{
+      auto cst = constraints;
+      cst.forbidden += latentVariablesIds();
+      for(auto bd : backdoor_generator(observationalBN(), cause, effect, cst)){
+         return bd;
+      }
+      return std::nullopt;
+   }
+
    template<typename GUM_SCALAR>
    std::optional<std::set<std::string>> CausalModel<GUM_SCALAR>::backDoor_withNames(std::string cause, std::string effect){
       return backDoor_withNames(idFromName(cause), idFromName(effect));
@@ -248,122 +480,159 @@ namespace gum{
       return std::nullopt;
    }
 
+   template<typename GUM_SCALAR>
+   std::optional<gum::NodeSet> CausalModel<GUM_SCALAR>::frontDoor(gum::NodeId cause, gum::NodeId effect, const gum::NodeSet& knowing) const{
+      for(auto bd : conditional_frontdoor_generator(observationalBN(), cause, effect, knowing, latentVariablesIds())){
+         return bd;
+      }
+      return std::nullopt;
+   }
+
+   template<typename GUM_SCALAR>
+   std::optional<gum::NodeSet> CausalModel<GUM_SCALAR>::adjustment(const gum::NodeSet& causes, const gum::NodeSet& effects) const{
+      auto zset = adjustment_set(*this, causes, effects, latentVariablesIds());
+      if(!zset) return std::nullopt;
+
+      // the canonical set may be large: greedily drops the nodes that are not
+      // needed, to keep the adjustment formula small
+      const auto pbd = proper_backdoor_graph(*this, causes, effects);
+      for(const auto& z : NodeSet(zset.value())){
+         zset.value().erase(z);
+         if(!isDSep(pbd, causes, effects, zset.value())) zset.value().insert(z);
+      }
+      return zset;
+   }
+
 
    template <typename GUM_SCALAR>
    const DAG& CausalModel<GUM_SCALAR>::dag() const{
-      return _ca_BN_.dag();
+      return dag_;
    }
 
    
    template <typename GUM_SCALAR>
    Size CausalModel<GUM_SCALAR>::size() const{
-      return _ca_BN_.size();
+      return dag_.size();
    }
 
    
    template <typename GUM_SCALAR>
    Size CausalModel<GUM_SCALAR>::sizeArcs() const{
-      return _ca_BN_.sizeArcs();
+      return dag_.sizeArcs();
    }
 
    
    template <typename GUM_SCALAR>
    bool CausalModel<GUM_SCALAR>::exists(NodeId node) const{
-      return _ca_BN_.exists(node);
+      return dag_.exists(node);
    }
 
    
    template <typename GUM_SCALAR>
    bool CausalModel<GUM_SCALAR>::exists(const std::string& name) const{
-      return _ca_BN_.exists(name);
+      return _varMap_.exists(name);
    }
 
    
    template <typename GUM_SCALAR>
    NodeSet CausalModel<GUM_SCALAR>::family(const NodeId id) const{
-      return _ca_BN_.family(id);
+      auto res = NodeSet(dag_.parents(id));
+      res.insert(id);
+      return res;
    }
 
    
    template <typename GUM_SCALAR>
    NodeSet CausalModel<GUM_SCALAR>::family(const std::string& name) const{
-      return _ca_BN_.family(name);
+      return family(idFromName(name));
    }
 
    
    template <typename GUM_SCALAR>
    NodeSet CausalModel<GUM_SCALAR>::descendants(const NodeId id) const{
-      return _ca_BN_.descendants(id);
+      return dag_.descendants(id);
    }
 
    
    template <typename GUM_SCALAR>
    NodeSet CausalModel<GUM_SCALAR>::descendants(const std::string& name) const{
-      return _ca_BN_.descendants(name);
+      return dag_.descendants(idFromName(name));
    }
 
    
    template <typename GUM_SCALAR>
    NodeSet CausalModel<GUM_SCALAR>::ancestors(const NodeId id) const{
-      return _ca_BN_.ancestors(id);
+      return dag_.ancestors(id);
    }
 
    
    template <typename GUM_SCALAR>
    NodeSet CausalModel<GUM_SCALAR>::ancestors(const std::string& name) const{
-      return _ca_BN_.ancestors(name);
+      return dag_.ancestors(idFromName(name));
    }
 
    
    template <typename GUM_SCALAR>
    UndiGraph CausalModel<GUM_SCALAR>::moralizedAncestralGraph(const NodeSet& nodes) const{
-      return _ca_BN_.moralizedAncestralGraph(nodes);
+      return dag_.moralizedAncestralGraph(nodes);
    }
 
    
    template <typename GUM_SCALAR>
    UndiGraph CausalModel<GUM_SCALAR>::moralizedAncestralGraph(const std::vector< std::string >& nodenames) const{
-      return _ca_BN_.moralizedAncestralGraph(nodenames);
+      auto ids = NodeSet();
+      for(const auto& name : nodenames) ids.insert(idFromName(name));
+      return dag_.moralizedAncestralGraph(ids);
    }
 
    
    template <typename GUM_SCALAR>
    bool CausalModel<GUM_SCALAR>::isIndependent(NodeId X, NodeId Y, const NodeSet& Z) const{
-      return _ca_BN_.isIndependent(X, Y, Z);
+      return dag_.dSeparation(X, Y, Z);
    }
 
    
    template <typename GUM_SCALAR>
    bool CausalModel<GUM_SCALAR>::isIndependent(const NodeSet& X, const NodeSet& Y, const NodeSet& Z) const{
-      return _ca_BN_.isIndependent(X, Y, Z);
+      return dag_.dSeparation(X, Y, Z);
    }
 
    
    template <typename GUM_SCALAR>
    UndiGraph CausalModel<GUM_SCALAR>::moralGraph() const{
-      return _ca_BN_.moralGraph();
+      return dag_.moralGraph();
    }
 
    
    template <typename GUM_SCALAR>
    Sequence< NodeId > CausalModel<GUM_SCALAR>::topologicalOrder() const{
-      return _ca_BN_.topologicalOrder();
+      return dag_.topologicalOrder();
    }
 
    
    template <typename GUM_SCALAR>
    bool CausalModel<GUM_SCALAR>::hasSameStructure(const DAGmodel& other){
-      return _ca_BN_.hasSameStructure(other);
+      return DAGmodel::hasSameStructure(other);
    }
 
    
    template <typename GUM_SCALAR>
    CausalModel<GUM_SCALAR>& CausalModel<GUM_SCALAR>::operator=(const CausalModel<GUM_SCALAR>& source){
-      _ob_BN_ = source._ob_BN_;
-      _ca_BN_ = source._ca_BN_;
+      DAGmodel::operator=(source);
       _keepArcs_ = source._keepArcs_;
+      _varMap_ = source._varMap_;
       _lat_ = source._lat_;
       _names_ = source._names_;
+      _invalidate_();
+      _symbols_ = source._symbols_;
+      _symbolNodes_ = source._symbolNodes_;
+      _nodeSymbols_ = source._nodeSymbols_;
+      _districts_ = source._districts_;
+      _fingerprint_ = source._fingerprint_;
+      _latentChildren_ = source._latentChildren_;
+      _clock_ = source._clock_;
+      _versions_ = source._versions_;
+      return *this;
    }
 
    
@@ -399,4 +668,75 @@ namespace gum{
       }
       return CausalModel<GUM_SCALAR>(bn, latentVarsDescriptor, true);
    }
+
+   template<typename GUM_SCALAR>
+   bool isSemiMarkovian(const CausalModel<GUM_SCALAR>& cm){
+      const auto& lat = cm.latentVariablesIds();
+      auto seen = std::set<std::vector<gum::NodeId>>();
+      for(const auto& l : lat){
+         if(!cm.parents(l).empty()) return false;
+         const auto& ch = cm.children(l);
+         if(ch.size() < 2 || !(ch * lat).empty()) return false;
+         auto key = std::vector<gum::NodeId>(ch.begin(), ch.end());
+         std::sort(key.begin(), key.end());
+         if(!seen.insert(std::move(key)).second) return false;
+      }
+      return true;
+   }
+
+   /// the observed nodes reached from the latent ``l`` through latent nodes only
+   template<typename GUM_SCALAR>
+   NodeSet _LP_observedReach_(const CausalModel<GUM_SCALAR>& cm, gum::NodeId l){
+      const auto& lat = cm.latentVariablesIds();
+      auto res = NodeSet();
+      auto visited = NodeSet({l});
+      auto stack = std::vector<gum::NodeId>({l});
+      while(!stack.empty()){
+         const auto x = stack.back();
+         stack.pop_back();
+         for(const auto& c : cm.children(x)){
+            if(!lat.contains(c)) res.insert(c);
+            else if(!visited.contains(c)){
+               visited.insert(c);
+               stack.push_back(c);
+            }
+         }
+      }
+      return res;
+   }
+
+   template<typename GUM_SCALAR>
+   CausalModel<GUM_SCALAR> latentProjection(const CausalModel<GUM_SCALAR>& cm){
+      const auto& lat = cm.latentVariablesIds();
+      auto res = CausalModel<GUM_SCALAR>(cm.observationalBN());
+      // the arcs of the observational BN erased from cm (by addLatentVariable)
+      for(const auto& a : cm.observationalBN().arcs())
+         if(!cm.dag().existsArc(a.tail(), a.head())) res.eraseCausalArc(a.tail(), a.head());
+
+      // latent ids in increasing order, so that the projection is deterministic
+      auto order = std::vector<gum::NodeId>(lat.begin(), lat.end());
+      std::sort(order.begin(), order.end());
+      auto reach = gum::HashTable<gum::NodeId, NodeSet>();
+      for(const auto& l : order) reach.insert(l, _LP_observedReach_(cm, l));
+
+      for(const auto& a : cm.arcs()){
+         if(lat.contains(a.tail())) continue;
+         if(!lat.contains(a.head())) res.addCausalArc(a.tail(), a.head());
+         else for(const auto& c : reach[a.head()]) res.addCausalArc(a.tail(), c);
+      }
+
+      // a latent with a latent parent confounds a subset of what its root confounds
+      auto seen = std::set<std::vector<gum::NodeId>>();
+      const auto& names = cm.names();
+      for(const auto& l : order){
+         if(!(cm.parents(l) * lat).empty()) continue;
+         const auto& r = reach[l];
+         if(r.size() < 2) continue;
+         auto children = std::vector<gum::NodeId>(r.begin(), r.end());
+         std::sort(children.begin(), children.end());
+         if(!seen.insert(children).second) continue;
+         res.addLatentVariable(names[l], children, true);
+      }
+      return res;
+   }
 }
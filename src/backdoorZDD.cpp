@@ -0,0 +1,457 @@
+#include "backdoorZDD.h"
+#include "dSeparation.h"
+#include "fingerprint.h"
+#include "reachability.h"
+
+#include <functional>
+#include <memory>
+#include <limits>
+#include <bit>
+#include <algorithm>
+#include <unordered_map>
+
+namespace gum{
+
+    std::size_t BackdoorZDD::_NodeHash_::operator()(const _Node_& n) const {
+        return fingerprint_mix(n.var ^ fingerprint_mix(n.lo ^ fingerprint_mix(n.hi)));
+    }
+
+    bool BackdoorZDD::_NodeEq_::operator()(const _Node_& a, const _Node_& b) const {
+        return a.var == b.var && a.lo == b.lo && a.hi == b.hi;
+    }
+
+    BackdoorZDD::BackdoorZDD()
+        : _vars_(), _required_(), _nodes_(), _unique_(), _root_(_bottom_), _counts_()
+    {
+        _nodes_.push_back(_Node_{0, _bottom_, _bottom_});
+        _nodes_.push_back(_Node_{0, _top_, _top_});
+        GUM_CONSTRUCTOR(BackdoorZDD)
+    }
+
+    BackdoorZDD::BackdoorZDD(const BackdoorZDD& other)
+        : _vars_(other._vars_), _required_(other._required_), _nodes_(other._nodes_), _unique_(other._unique_),
+          _root_(other._root_), _counts_(other._counts_)
+    {
+        GUM_CONS_CPY(BackdoorZDD)
+    }
+
+    BackdoorZDD::BackdoorZDD(BackdoorZDD&& other)
+        : _vars_(std::move(other._vars_)), _required_(std::move(other._required_)), _nodes_(std::move(other._nodes_)),
+          _unique_(std::move(other._unique_)), _root_(other._root_), _counts_(std::move(other._counts_))
+    {
+        GUM_CONS_MOV(BackdoorZDD)
+    }
+
+    BackdoorZDD::~BackdoorZDD(){
+        GUM_DESTRUCTOR(BackdoorZDD)
+    }
+
+    namespace {
+
+        /**
+         * @brief internal : the part of a choice of candidates of the first levels that the
+         * candidates of the next levels can see, as a canonical key : two choices with the
+         * same key at the same level have the same valid completions.
+         *
+         * A set is tested in the moral graph of the ancestors of the set, the required nodes,
+         * the cause and the effect (the arcs out of the cause being removed). Choosing more
+         * candidates only adds the moral cliques of their ancestors, which meet the current
+         * ancestral set on ancestors of the next candidates (the attachment nodes), and removes
+         * next candidates. The key keeps the attachment nodes of the ancestral set, the next
+         * candidates in it and their connections, the other nodes being contracted.
+         */
+        class _ZDDFrontier_ {
+        private:
+            const CompactDigraph& _g_;
+            NodeId _cause_;
+            NodeId _effect_;
+            std::vector<NodeId> _required_;
+            std::vector<Size> _level_;  ///< level of each candidate, n for the other nodes
+            std::vector<Size> _last_;   ///< last level with a candidate descending from each node, n if none
+            Size _n_;
+
+            // scratch buffers, stamped by key()
+            std::vector<Size> _inA_;
+            std::vector<Size> _removed_;
+            Size _stamp_;
+            std::vector<NodeId> _uf_;
+            std::vector<NodeId> _nodes_;
+
+            NodeId _find_(NodeId v){
+                while(_uf_[v] != v) v = _uf_[v] = _uf_[_uf_[v]];
+                return v;
+            }
+
+        public:
+            _ZDDFrontier_(const CompactDigraph& g, NodeId cause, NodeId effect, const std::vector<NodeId>& vars, const NodeSet& required)
+                : _g_(g), _cause_(cause), _effect_(effect), _required_(required.begin(), required.end()),
+                  _level_(g.bound(), vars.size()), _last_(g.bound(), vars.size()), _n_(vars.size()),
+                  _inA_(g.bound(), 0), _removed_(g.bound(), 0), _stamp_(0), _uf_(g.bound(), 0), _nodes_()
+            {
+                for(Size j = 0; j < _n_; j++) _level_[vars[j]] = j;
+                // the candidates from the last one : a node keeps the first (largest) level reaching it
+                auto stack = std::vector<NodeId>();
+                for(Size j = _n_; j-- > 0;){
+                    if(_last_[vars[j]] != _n_) continue;
+                    _last_[vars[j]] = j;
+                    stack.push_back(vars[j]);
+                    while(!stack.empty()){
+                        const auto v = stack.back();
+                        stack.pop_back();
+                        for(const auto p : _g_.parents(v)){
+                            if(_last_[p] != _n_) continue;
+                            _last_[p] = j;
+                            stack.push_back(p);
+                        }
+                    }
+                }
+            }
+
+            /// the key of the choice ``chosen`` before the level ``level``, ``budget`` candidates being left
+            std::vector<uint64_t> key(Size level, const std::vector<NodeId>& chosen, Size budget){
+                ++_stamp_;
+                const auto attach = [&](NodeId v){ return _last_[v] != _n_ && _last_[v] >= level; };
+                const auto next = [&](NodeId v){ return _level_[v] != _n_ && _level_[v] >= level; };
+
+                // the ancestral set
+                _nodes_.clear();
+                const auto visit = [&](NodeId v){
+                    if(_inA_[v] == _stamp_) return;
+                    _inA_[v] = _stamp_;
+                    _nodes_.push_back(v);
+                };
+                visit(_cause_);
+                visit(_effect_);
+                for(const auto r : _required_){ visit(r); _removed_[r] = _stamp_; }
+                for(const auto z : chosen){ visit(z); _removed_[z] = _stamp_; }
+                for(Size i = 0; i < _nodes_.size(); i++)
+                    for(const auto p : _g_.parents(_nodes_[i])) visit(p);
+                for(const auto v : _nodes_) _uf_[v] = v;
+
+                // the moral cliques : the nodes that stay are contracted, the next candidates
+                // (which may be removed later) are kept with their neighbours
+                auto edges = std::vector<std::pair<NodeId, NodeId>>();
+                auto clique = std::vector<NodeId>();
+                for(const auto x : _nodes_){
+                    clique.clear();
+                    if(_removed_[x] != _stamp_) clique.push_back(x);
+                    for(const auto p : _g_.parents(x))
+                        if(_removed_[p] != _stamp_ && (x == _cause_ || p != _cause_)) clique.push_back(p);
+                    NodeId stay = _g_.bound();
+                    for(const auto v : clique){
+                        if(next(v)) continue;
+                        if(stay == _g_.bound()) stay = v;
+                        else _uf_[_find_(v)] = _find_(stay);
+                    }
+                    for(Size i = 0; i < clique.size(); i++){
+                        if(!next(clique[i])) continue;
+                        for(Size j = 0; j < clique.size(); j++)
+                            if(j != i && (!next(clique[j]) || clique[j] > clique[i])) edges.emplace_back(clique[i], clique[j]);
+                    }
+                }
+
+                // each contracted class : its cause, effect and attachment nodes, then its next candidates
+                auto index = HashTable<NodeId, Size>();
+                auto classes = std::vector<std::pair<std::vector<uint64_t>, std::vector<uint64_t>>>();
+                const auto classOf = [&](NodeId v) -> std::pair<std::vector<uint64_t>, std::vector<uint64_t>>& {
+                    const auto root = _find_(v);
+                    if(!index.exists(root)){
+                        index.insert(root, classes.size());
+                        classes.emplace_back();
+                    }
+                    return classes[index[root]];
+                };
+                auto nexts = std::vector<uint64_t>();
+                auto removedAttach = std::vector<uint64_t>();
+                auto qedges = std::vector<std::pair<uint64_t, uint64_t>>();
+                for(const auto v : _nodes_){
+                    if(_removed_[v] == _stamp_){
+                        if(attach(v)) removedAttach.push_back(v);
+                        continue;
+                    }
+                    if(next(v)){ nexts.push_back(v); continue; }
+                    if(v == _cause_ || v == _effect_ || attach(v))
+                        classOf(v).first.push_back(v);
+                }
+                for(const auto& [q, v] : edges){
+                    if(next(v)){ qedges.emplace_back(q, v); continue; }
+                    classOf(v).second.push_back(q);
+                }
+
+                auto descr = std::vector<std::vector<uint64_t>>();
+                for(auto& [labels, adj] : classes){
+                    std::sort(adj.begin(), adj.end());
+                    adj.erase(std::unique(adj.begin(), adj.end()), adj.end());
+                    if(labels.empty() && adj.size() < 2) continue; // a dead end
+                    std::sort(labels.begin(), labels.end());
+                    auto d = labels;
+                    d.push_back(~uint64_t(0));
+                    d.insert(d.end(), adj.begin(), adj.end());
+                    descr.push_back(std::move(d));
+                }
+                std::sort(descr.begin(), descr.end());
+                descr.erase(std::unique(descr.begin(), descr.end()), descr.end());
+                std::sort(nexts.begin(), nexts.end());
+                std::sort(removedAttach.begin(), removedAttach.end());
+                std::sort(qedges.begin(), qedges.end());
+                qedges.erase(std::unique(qedges.begin(), qedges.end()), qedges.end());
+
+                auto res = std::vector<uint64_t>({level, std::min<Size>(budget, _n_ - level), nexts.size()});
+                res.insert(res.end(), nexts.begin(), nexts.end());
+                res.push_back(removedAttach.size());
+                res.insert(res.end(), removedAttach.begin(), removedAttach.end());
+                res.push_back(qedges.size());
+                for(const auto& [a, b] : qedges){ res.push_back(a); res.push_back(b); }
+                for(const auto& d : descr){
+                    res.push_back(d.size());
+                    res.insert(res.end(), d.begin(), d.end());
+                }
+                return res;
+            }
+        };
+
+        struct _ZDDKeyHash_ {
+            std::size_t operator()(const std::vector<uint64_t>& k) const {
+                uint64_t h = k.size();
+                for(const auto w : k) h = fingerprint_mix(h ^ w);
+                return h;
+            }
+        };
+    }
+
+    BackdoorZDD::BackdoorZDD(const DAG& G, NodeId cause, NodeId effect, const std::vector<NodeId>& candidates, const BackdoorConstraints& constraints)
+        : _vars_(candidates), _required_(constraints.required), _nodes_(), _unique_(), _root_(_bottom_), _counts_()
+    {
+        const Size n = _vars_.size();
+        _nodes_.push_back(_Node_{n, _bottom_, _bottom_});
+        _nodes_.push_back(_Node_{n, _top_, _top_});
+        if(_required_.size() > constraints.maxSize){
+            GUM_CONSTRUCTOR(BackdoorZDD)
+            return;
+        }
+        const Size budget = constraints.maxSize - _required_.size();
+
+        // existence of a valid set containing the chosen candidates and other candidates 
+        // of the levels from ``level`` only : words when everything fits in 64 bits
+        std::function<bool(Size)> extensible;
+
+        auto separator = std::unique_ptr<SmallBackdoorSeparator>();
+        uint64_t in = 0;
+        const auto cg = CompactDigraph(G);
+        auto chosen = std::vector<NodeId>();
+        auto anc = std::vector<char>();
+        if(n <= 64 && G.size() <= 64){
+            separator = std::make_unique<SmallBackdoorSeparator>(G, cause, effect, _vars_, _required_);
+            extensible = [&](Size level){
+                const auto free = level >= n ? uint64_t(0) : (n - level == 64 ? ~uint64_t(0) : (uint64_t(1) << (n - level)) - 1);
+                return separator->extensible(in, free);
+            };
+        }else{
+            extensible = [&](Size level){
+                anc.assign(cg.bound(), 0);
+                auto stack = std::vector<NodeId>();
+                auto zset = NodeSet(_required_);
+                for(const auto z : chosen) zset.insert(z);
+                for(const auto& v : zset + NodeSet({cause, effect})){
+                    if(anc[v]) continue;
+                    anc[v] = 1;
+                    stack.push_back(v);
+                }
+                while(!stack.empty()){
+                    const auto v = stack.back();
+                    stack.pop_back();
+                    for(const auto p : cg.parents(v)){
+                        if(anc[p]) continue;
+                        anc[p] = 1;
+                        stack.push_back(p);
+                    }
+                }
+                for(Size j = level; j < n; j++)
+                    if(anc[_vars_[j]]) zset.insert(_vars_[j]);
+                return isDSep_parents(G, NodeSet({cause}), NodeSet({effect}), zset);
+            };
+        }
+        const auto choose = [&](Size level, bool add){
+            if(add){
+                chosen.push_back(_vars_[level]);
+                in |= uint64_t(1) << (n - 1 - level);
+            }else{
+                chosen.pop_back();
+                in &= ~(uint64_t(1) << (n - 1 - level));
+            }
+        };
+
+        // the choices with the same frontier have the same completions : each one is built once
+        auto frontier = _ZDDFrontier_(cg, cause, effect, _vars_, _required_);
+        auto memo = std::unordered_map<std::vector<uint64_t>, Size, _ZDDKeyHash_>();
+        std::function<Size(Size, Size)> build = [&](Size level, Size k) -> Size {
+            if(level == n) return extensible(level) ? _top_ : _bottom_;
+            auto key = frontier.key(level, chosen, budget - k);
+            if(const auto it = memo.find(key); it != memo.end()) return it->second;
+            auto res = _bottom_;
+            if(extensible(level)){
+                const auto lo = build(level + 1, k);
+                auto hi = _bottom_;
+                if(k < budget){
+                    choose(level, true);
+                    hi = build(level + 1, k + 1);
+                    choose(level, false);
+                }
+                res = _mk_(level, lo, hi);
+            }
+            memo.emplace(std::move(key), res);
+            return res;
+        };
+        _root_ = build(0, 0);
+        GUM_CONSTRUCTOR(BackdoorZDD)
+    }
+
+    Size BackdoorZDD::_mk_(Size var, Size lo, Size hi){
+        if(hi == _bottom_) return lo; // zero-suppression rule
+        const auto node = _Node_{var, lo, hi};
+        if(const auto it = _unique_.find(node); it != _unique_.end()) return it->second;
+        _nodes_.push_back(node);
+        _unique_.emplace(node, _nodes_.size() - 1);
+        _counts_.clear();
+        return _nodes_.size() - 1;
+    }
+
+    const std::vector<double>& BackdoorZDD::_countsOf_() const {
+        if(_counts_.size() == _nodes_.size()) return _counts_;
+        // the children of a node are always created before it
+        _counts_.assign(_nodes_.size(), 0);
+        _counts_[_top_] = 1;
+        for(Size i = _top_ + 1; i < _nodes_.size(); i++)
+            _counts_[i] = _counts_[_nodes_[i].lo] + _counts_[_nodes_[i].hi];
+        return _counts_;
+    }
+
+    double BackdoorZDD::count() const {
+        return _countsOf_()[_root_];
+    }
+
+    Size BackdoorZDD::size() const {
+        return _nodes_.size();
+    }
+
+    bool BackdoorZDD::empty() const {
+        return _root_ == _bottom_;
+    }
+
+    std::optional<NodeSet> BackdoorZDD::minCost(const HashTable<NodeId, double>& costs) const {
+        if(empty()) return std::nullopt;
+        auto best = std::vector<double>(_nodes_.size(), std::numeric_limits<double>::infinity());
+        auto takeHi = std::vector<char>(_nodes_.size(), 0);
+        best[_top_] = 0;
+        for(Size i = _top_ + 1; i < _nodes_.size(); i++){
+            const auto& nd = _nodes_[i];
+            const auto v = _vars_[nd.var];
+            const auto withV = best[nd.hi] + (costs.exists(v) ? costs[v] : 1.0);
+            takeHi[i] = withV < best[nd.lo];
+            best[i] = takeHi[i] ? withV : best[nd.lo];
+        }
+
+        auto res = NodeSet(_required_);
+        for(auto i = _root_; i > _top_;){
+            if(takeHi[i]){
+                res.insert(_vars_[_nodes_[i].var]);
+                i = _nodes_[i].hi;
+            }else{
+                i = _nodes_[i].lo;
+            }
+        }
+        return res;
+    }
+
+    NodeSet BackdoorZDD::sample(std::mt19937_64& gen) const {
+        if(empty()) GUM_ERROR(NotFound, "no backdoor set to sample from")
+        const auto& counts = _countsOf_();
+        auto unif = std::uniform_real_distribution<double>(0.0, 1.0);
+
+        auto res = NodeSet(_required_);
+        for(auto i = _root_; i > _top_;){
+            const auto& nd = _nodes_[i];
+            if(unif(gen) * counts[i] < counts[nd.hi]){
+                res.insert(_vars_[nd.var]);
+                i = nd.hi;
+            }else{
+                i = nd.lo;
+            }
+        }
+        return res;
+    }
+
+    BackdoorZDD::iterator BackdoorZDD::begin() const {
+        return iterator(this);
+    }
+
+    BackdoorZDD::iterator BackdoorZDD::end() const {
+        return iterator();
+    }
+
+
+    BackdoorZDD::iterator::iterator()
+        : _zdd_(nullptr), _path_(), _cur_()
+    {}
+
+    BackdoorZDD::iterator::iterator(const BackdoorZDD* zdd)
+        : _zdd_(zdd), _path_(), _cur_()
+    {
+        if(_zdd_->empty()) _zdd_ = nullptr;
+        else _descend_(_zdd_->_root_);
+    }
+
+    void BackdoorZDD::iterator::_descend_(Size node){
+        while(true){
+            while(node > _top_){
+                _path_.push_back({node, false});
+                node = _zdd_->_nodes_[node].lo;
+            }
+            if(node == _top_) break;
+            if(!_backtrack_(node)) return;
+        }
+        _cur_ = _zdd_->_required_;
+        for(const auto& [nd, high] : _path_)
+            if(high) _cur_.insert(_zdd_->_vars_[_zdd_->_nodes_[nd].var]);
+    }
+
+    bool BackdoorZDD::iterator::_backtrack_(Size& node){
+        while(!_path_.empty() && _path_.back().second) _path_.pop_back();
+        if(_path_.empty()){
+            _zdd_ = nullptr;
+            return false;
+        }
+        _path_.back().second = true;
+        node = _zdd_->_nodes_[_path_.back().first].hi;
+        return true;
+    }
+
+    BackdoorZDD::iterator::reference BackdoorZDD::iterator::operator*() const {
+        return _cur_;
+    }
+
+    BackdoorZDD::iterator::pointer BackdoorZDD::iterator::operator->() const {
+        return &_cur_;
+    }
+
+    BackdoorZDD::iterator& BackdoorZDD::iterator::operator++(){
+        if(_zdd_ == nullptr) return *this;
+        Size node;
+        if(_backtrack_(node)) _descend_(node);
+        return *this;
+    }
+
+    BackdoorZDD::iterator BackdoorZDD::iterator::operator++(int){
+        auto tmp = *this; ++(*this);
+        return tmp;
+    }
+
+    bool operator==(const BackdoorZDD::iterator& a, const BackdoorZDD::iterator& b){
+        if(a._zdd_ == nullptr || b._zdd_ == nullptr) return a._zdd_ == b._zdd_;
+        return a._zdd_ == b._zdd_ && a._path_ == b._path_;
+    }
+
+    bool operator!=(const BackdoorZDD::iterator& a, const BackdoorZDD::iterator& b){
+        return !(a == b);
+    }
+}
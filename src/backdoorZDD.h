@@ -0,0 +1,170 @@
+#ifndef GUM_BACKDOOR_ZDD_H
+#define GUM_BACKDOOR_ZDD_H
+
+#include <agrum/BN/BayesNet.h>
+#include <agrum/tools/core/set.h>
+#include <agrum/tools/core/hashTable.h>
+#include <vector>
+#include <unordered_map>
+#include <optional>
+#include <random>
+#include <iterator>
+
+#include "doorCriteria.h"
+
+namespace gum{
+
+    /**
+     * @class BackdoorZDD
+     * @brief Zero-suppressed decision diagram holding the whole family of
+     * backdoor sets (minimal or not) of a pair of nodes under some
+     * @ref BackdoorConstraints.
+     *
+     * Each level of the diagram is a candidate node of the backdoor search;
+     * a path from the root to the terminal ⊤ is a set (the candidates whose
+     * high branch is taken, plus the required nodes). Identical sub-diagrams
+     * are shared through a unique table, so the family is never materialized:
+     * counting, minimum-cost extraction and uniform sampling are linear in the
+     * size of the diagram and the sets can be iterated lazily.
+     *
+     * The diagram is built with the validity test of @ref BackdoorIterator
+     * (the separation of the cause and the effect in the reduced graph). A
+     * branch is cut as soon as no valid set can extend the nodes already
+     * chosen with the remaining candidates (see @ref SmallBackdoorSeparator::extensible),
+     * so the construction only explores prefixes of valid sets. Two prefixes
+     * that the next candidates see the same way (same ancestral nodes linked
+     * to the next levels, same connections between them in the moral graph)
+     * have the same completions : their sub-diagram is built once, and the
+     * construction is linear in the size of the diagram times the cost of a
+     * separation test rather than in the number of sets.
+     */
+    class BackdoorZDD {
+    private:
+        struct _Node_ {
+            Size var; ///< level (index of the candidate)
+            Size lo;  ///< the sets without the candidate
+            Size hi;  ///< the sets with the candidate
+        };
+        struct _NodeHash_ {
+            std::size_t operator()(const _Node_& n) const;
+        };
+        struct _NodeEq_ {
+            bool operator()(const _Node_& a, const _Node_& b) const;
+        };
+
+        static constexpr Size _bottom_ = 0; ///< the empty family
+        static constexpr Size _top_ = 1;    ///< the family containing only the empty set
+
+        std::vector<NodeId> _vars_;        ///< the candidate of each level
+        NodeSet _required_;                ///< nodes added to every set
+        std::vector<_Node_> _nodes_;
+        std::unordered_map<_Node_, Size, _NodeHash_, _NodeEq_> _unique_;
+        Size _root_;
+        mutable std::vector<double> _counts_; ///< number of sets below each node, computed on demand
+
+        Size _mk_(Size var, Size lo, Size hi);
+        const std::vector<double>& _countsOf_() const;
+
+    public:
+        /**
+         * @brief Iterates lazily over the sets of the diagram : only the
+         * current path of the diagram is kept.
+         */
+        class iterator {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using difference_type   = std::ptrdiff_t;
+            using value_type        = NodeSet;
+            using pointer           = const value_type*;
+            using reference         = const value_type&;
+
+        private:
+            const BackdoorZDD* _zdd_;
+            std::vector<std::pair<Size, bool>> _path_; ///< nodes of the current path and the branch taken
+            NodeSet _cur_;
+
+            /// follows the low branches from ``node`` (backtracking on dead ends) up to the next set
+            void _descend_(Size node);
+            /// pops the finished nodes of the path, ``node`` being the next high branch ; false at the end
+            bool _backtrack_(Size& node);
+
+        public:
+            iterator();
+            explicit iterator(const BackdoorZDD* zdd);
+
+            reference operator*() const;
+            pointer operator->() const;
+            iterator& operator++();
+            iterator operator++(int);
+            friend bool operator==(const iterator& a, const iterator& b);
+            friend bool operator!=(const iterator& a, const iterator& b);
+        };
+
+        /**
+         * @brief Builds the diagram of the backdoor sets of ``(cause, effect)`` in ``G``
+         *
+         * @param G the reduced graph of the backdoor search
+         * @param cause
+         * @param effect
+         * @param candidates the candidate nodes, in the order of the levels
+         * @param constraints only the required nodes and the maximal size are used here
+         */
+        BackdoorZDD(const DAG& G, NodeId cause, NodeId effect, const std::vector<NodeId>& candidates, const BackdoorConstraints& constraints);
+
+        /// the diagram of the empty family
+        BackdoorZDD();
+        BackdoorZDD(const BackdoorZDD& other);
+        BackdoorZDD(BackdoorZDD&& other);
+        ~BackdoorZDD();
+
+        /// number of sets in the family (as a double : it may be astronomically large)
+        double count() const;
+
+        /// number of nodes of the diagram (terminals included)
+        Size size() const;
+
+        /// whether the family is empty
+        bool empty() const;
+
+        /**
+         * @brief Returns a set of the family minimizing the sum of the costs of
+         * its nodes (the required nodes are in every set and do not change the choice)
+         *
+         * @param costs cost of each candidate, 1 for the missing ones
+         * @return std::optional<NodeSet> nullopt if the family is empty
+         */
+        std::optional<NodeSet> minCost(const HashTable<NodeId, double>& costs) const;
+
+        /**
+         * @brief Draws a set of the family uniformly at random
+         *
+         * @param gen the random generator
+         * @return NodeSet
+         * @throw NotFound if the family is empty
+         */
+        NodeSet sample(std::mt19937_64& gen) const;
+
+        iterator begin() const;
+        iterator end() const;
+    };
+
+    /**
+     * @brief Builds the diagram of all the backdoor sets for the pair of nodes `(cause, effect)` in the
+     * graph `bn` satisfying `constraints`, on the same reduced graph and candidates as @ref backdoor_generator
+     * (the allowed nodes being a preference, the diagram holds the other sets too : give them a higher
+     * cost in @ref BackdoorZDD::minCost)
+     *
+     * @tparam GUM_SCALAR
+     * @param bn
+     * @param cause
+     * @param effect
+     * @param constraints
+     * @return BackdoorZDD
+     */
+    template<typename GUM_SCALAR>
+    BackdoorZDD backdoor_zdd(const BayesNet<GUM_SCALAR>& bn, NodeId cause, NodeId effect, const BackdoorConstraints& constraints = BackdoorConstraints());
+}
+
+#include "backdoorZDD_tpl.h"
+
+#endif
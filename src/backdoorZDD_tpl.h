@@ -0,0 +1,12 @@
+#include "backdoorZDD.h"
+
+namespace gum{
+
+    template<typename GUM_SCALAR>
+    BackdoorZDD backdoor_zdd(const BayesNet<GUM_SCALAR>& bn, NodeId cause, NodeId effect, const BackdoorConstraints& constraints){
+        std::shared_ptr<DAG> G;
+        std::shared_ptr<NodeSet> possible;
+        if(!_BD_search_space_(bn, cause, effect, constraints, G, possible)) return BackdoorZDD(); // empty
+        return BackdoorZDD(*G, cause, effect, std::vector<NodeId>(possible->begin(), possible->end()), constraints);
+    }
+}
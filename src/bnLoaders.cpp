@@ -0,0 +1,690 @@
+#include "bnLoaders.h"
+
+#include <unordered_map>
+#include <fstream>
+#include <algorithm>
+#include <cstdlib>
+#include <cctype>
+#include <cstring>
+
+namespace gum{
+
+    namespace {
+
+        /**
+         * @brief internal : buffered character source counting the lines, the
+         * stream being read by large blocks rather than character by character
+         */
+        class _IO_Reader_ {
+        private:
+            std::istream& _in_;
+            std::string _source_;
+            std::vector<char> _buf_;
+            std::size_t _pos_;
+            std::size_t _end_;
+            Size _line_;
+
+            bool _fill_(){
+                if(!_in_) return false;
+                _in_.read(_buf_.data(), _buf_.size());
+                _pos_ = 0;
+                _end_ = static_cast<std::size_t>(_in_.gcount());
+                return _end_ > 0;
+            }
+
+        public:
+            _IO_Reader_(std::istream& in, const std::string& source)
+                : _in_(in), _source_(source), _buf_(1 << 16), _pos_(0), _end_(0), _line_(1) {}
+
+            /// the next character without consuming it, -1 at the end
+            int peek(){
+                if(_pos_ == _end_ && !_fill_()) return -1;
+                return static_cast<unsigned char>(_buf_[_pos_]);
+            }
+
+            /// consumes the next character, -1 at the end
+            int get(){
+                const auto c = peek();
+                if(c < 0) return c;
+                _pos_++;
+                if(c == '\n') _line_++;
+                return c;
+            }
+
+            [[noreturn]] void error(const std::string& msg) const {
+                GUM_ERROR(IOError, _source_ << ":" << _line_ << ": " << msg)
+            }
+        };
+
+        /**
+         * @brief internal : tokens of the BIF and UAI formats. A token is a
+         * punctuation character, a quoted string (unquoted) or a run of other
+         * non-blank characters ; ``//`` and ``/ *`` comments are skipped if asked.
+         */
+        class _IO_Lexer_ {
+        private:
+            _IO_Reader_ _r_;
+            bool _comments_;
+            std::string _tok_;
+            bool _ready_;  ///< whether _tok_ holds the next token
+            bool _end_;    ///< whether the stream is exhausted
+
+            static bool _punct_(int c){
+                return c >= 0 && std::strchr("{}()[];,|=", c) != nullptr;
+            }
+
+            void _skip_(){
+                for(;;){
+                    const auto c = _r_.peek();
+                    if(c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f'){
+                        _r_.get();
+                        continue;
+                    }
+                    if(c != '/' || !_comments_) return;
+                    _r_.get();
+                    const auto d = _r_.get();
+                    if(d == '/'){
+                        for(auto e = _r_.get(); e >= 0 && e != '\n'; e = _r_.get()){}
+                    } else if(d == '*'){
+                        for(int prev = 0, e = _r_.get(); ; prev = e, e = _r_.get()){
+                            if(e < 0) _r_.error("unterminated comment");
+                            if(prev == '*' && e == '/') break;
+                        }
+                    } else _r_.error("unexpected '/'");
+                }
+            }
+
+            void _read_(){
+                if(_ready_) return;
+                _ready_ = true;
+                _tok_.clear();
+                _skip_();
+                const auto c = _r_.peek();
+                if(c < 0){
+                    _end_ = true;
+                    return;
+                }
+                if(_punct_(c)){
+                    _tok_.push_back(static_cast<char>(_r_.get()));
+                    return;
+                }
+                if(c == '"'){
+                    _r_.get();
+                    for(auto e = _r_.get(); e != '"'; e = _r_.get()){
+                        if(e < 0) _r_.error("unterminated string");
+                        _tok_.push_back(static_cast<char>(e));
+                    }
+                    return;
+                }
+                for(auto e = _r_.peek(); e >= 0 && !_punct_(e) && e != '"' && !std::isspace(e); e = _r_.peek()){
+                    if(_comments_ && e == '/') break;
+                    _tok_.push_back(static_cast<char>(_r_.get()));
+                }
+            }
+
+        public:
+            _IO_Lexer_(std::istream& in, const std::string& source, bool comments)
+                : _r_(in, source), _comments_(comments), _tok_(), _ready_(false), _end_(false) {}
+
+            bool atEnd(){
+                _read_();
+                return _end_;
+            }
+
+            const std::string& peek(){
+                _read_();
+                if(_end_) _r_.error("unexpected end of file");
+                return _tok_;
+            }
+
+            std::string next(){
+                peek();
+                _ready_ = false;
+                return std::move(_tok_);
+            }
+
+            /// consumes the next token if it is ``s``
+            bool accept(const char* s){
+                if(atEnd() || _tok_ != s) return false;
+                _ready_ = false;
+                return true;
+            }
+
+            void expect(const char* s){
+                if(!accept(s)) error(std::string("expected '") + s + "'");
+            }
+
+            double number(){
+                const auto t = next();
+                char* end = nullptr;
+                const auto v = std::strtod(t.c_str(), &end);
+                if(t.empty() || *end != '\0') error("expected a number, got '" + t + "'");
+                return v;
+            }
+
+            Size integer(){
+                const auto t = next();
+                char* end = nullptr;
+                const auto v = std::strtoull(t.c_str(), &end, 10);
+                if(t.empty() || *end != '\0') error("expected an integer, got '" + t + "'");
+                return static_cast<Size>(v);
+            }
+
+            /// skips the tokens up to the next ``;`` (included) at the current nesting level
+            void skipStatement(){
+                for(Size depth = 0; ; ){
+                    const auto t = next();
+                    if(t == "{") depth++;
+                    else if(t == "}"){
+                        if(depth == 0) error("unexpected '}'");
+                        depth--;
+                    } else if(t == ";" && depth == 0) return;
+                }
+            }
+
+            /// skips a ``{...}`` block, the ``{`` being the next token
+            void skipBlock(){
+                expect("{");
+                for(Size depth = 1; depth > 0; ){
+                    const auto t = next();
+                    if(t == "{") depth++;
+                    else if(t == "}") depth--;
+                }
+            }
+
+            [[noreturn]] void error(const std::string& msg) const {
+                _r_.error(msg);
+            }
+        };
+
+    }
+
+    /**
+     * @brief internal : copies a table read with the variables of the file in
+     * the order ``outPos`` (``cards`` given in the order of the file) into the
+     * order of the CPTs, the first variable varying the fastest
+     *
+     * @param values the table of the file
+     * @param cards the domain sizes, in the order of the file
+     * @param outPos the position of each variable of the file in the CPT
+     * @param lastFastest whether the last variable of the file varies the fastest
+     */
+    static std::vector<double> _IO_reorder_(const std::vector<double>& values, const std::vector<Size>& cards,
+                                            const std::vector<Size>& outPos, bool lastFastest){
+        const auto k = cards.size();
+        auto outCards = std::vector<Size>(k);
+        for(Size j = 0; j < k; j++) outCards[outPos[j]] = cards[j];
+        auto outStrides = std::vector<Size>(k, 1);
+        for(Size j = 1; j < k; j++) outStrides[j] = outStrides[j - 1] * outCards[j - 1];
+
+        auto res = std::vector<double>(values.size());
+        auto digits = std::vector<Size>(k, 0);
+        Size pos = 0;
+        for(Size i = 0; i < values.size(); i++){
+            res[pos] = values[i];
+            for(Size step = 0; step < k; step++){
+                const auto j = lastFastest ? k - 1 - step : step;
+                const auto stride = outStrides[outPos[j]];
+                if(++digits[j] < cards[j]){
+                    pos += stride;
+                    break;
+                }
+                pos -= stride * (cards[j] - 1);
+                digits[j] = 0;
+            }
+        }
+        return res;
+    }
+
+    /// internal : domain size of the CPT of ``i`` in ``desc``
+    static Size _IO_cptSize_(const BNDescription& desc, Idx i){
+        Size size = desc.states[i].size();
+        for(const auto& p : desc.parents[i]) size *= desc.states[p].size();
+        return size;
+    }
+
+    /// internal : the domain sizes of ``[i, parents...]``
+    static std::vector<Size> _IO_cards_(const BNDescription& desc, Idx i){
+        auto cards = std::vector<Size>({desc.states[i].size()});
+        for(const auto& p : desc.parents[i]) cards.push_back(desc.states[p].size());
+        return cards;
+    }
+
+    BNDescription parse_bif(std::istream& in, const std::string& source){
+        auto lex = _IO_Lexer_(in, source, true);
+        auto desc = BNDescription();
+        auto index = std::unordered_map<std::string, Idx>();
+
+        const auto varIndex = [&](const std::string& name){
+            const auto it = index.find(name);
+            if(it == index.end()) lex.error("unknown variable '" + name + "'");
+            return it->second;
+        };
+        const auto stateIndex = [&](Idx v, const std::string& label){
+            const auto& st = desc.states[v];
+            for(Idx s = 0; s < st.size(); s++)
+                if(st[s] == label) return s;
+            lex.error("unknown state '" + label + "' of '" + desc.names[v] + "'");
+        };
+        // numbers up to the ';', the commas being optional
+        const auto numbers = [&](std::vector<double>& out){
+            out.clear();
+            while(!lex.accept(";")){
+                if(lex.accept(",")) continue;
+                out.push_back(lex.number());
+            }
+        };
+
+        auto values = std::vector<double>();
+        while(!lex.atEnd()){
+            const auto kw = lex.next();
+            if(kw == "network"){
+                lex.next();
+                lex.skipBlock();
+            } else if(kw == "variable"){
+                const auto name = lex.next();
+                if(index.count(name)) lex.error("variable '" + name + "' declared twice");
+                const auto v = static_cast<Idx>(desc.names.size());
+                index.emplace(name, v);
+                desc.names.push_back(name);
+                desc.states.emplace_back();
+                desc.parents.emplace_back();
+                desc.tables.emplace_back();
+                lex.expect("{");
+                while(!lex.accept("}")){
+                    if(!lex.accept("type")){
+                        lex.skipStatement();
+                        continue;
+                    }
+                    lex.expect("discrete");
+                    lex.expect("[");
+                    const auto n = lex.integer();
+                    lex.expect("]");
+                    lex.expect("{");
+                    desc.states[v].reserve(n);
+                    while(!lex.accept("}")){
+                        if(lex.accept(",")) continue;
+                        desc.states[v].push_back(lex.next());
+                    }
+                    lex.expect(";");
+                    if(desc.states[v].size() != n) lex.error("wrong number of states for '" + name + "'");
+                }
+                // the tables are read row by row : a variable needs at least one state
+                if(desc.states[v].empty()) lex.error("no state for '" + name + "' (missing or empty type)");
+            } else if(kw == "probability"){
+                lex.expect("(");
+                const auto v = varIndex(lex.next());
+                auto& parents = desc.parents[v];
+                if(!parents.empty() || !desc.tables[v].empty()) lex.error("second probability block of '" + desc.names[v] + "'");
+                if(lex.accept("|"))
+                    while(!lex.accept(")")){
+                        if(lex.accept(",")) continue;
+                        parents.push_back(varIndex(lex.next()));
+                    }
+                else lex.expect(")");
+
+                const auto card = desc.states[v].size();
+                const auto size = _IO_cptSize_(desc, v);
+                auto& table = desc.tables[v];
+                table.assign(size, 0.0);
+                auto set = std::vector<char>(size / card, 0); // rows given by a table or a (...) line
+                auto defaults = std::vector<double>();
+
+                lex.expect("{");
+                while(!lex.accept("}")){
+                    if(lex.accept("table")){
+                        numbers(values);
+                        if(values.size() != size) lex.error("wrong table size for '" + desc.names[v] + "'");
+                        auto outPos = std::vector<Size>(parents.size() + 1);
+                        for(Size j = 0; j < outPos.size(); j++) outPos[j] = j;
+                        table = _IO_reorder_(values, _IO_cards_(desc, v), outPos, true);
+                        set.assign(set.size(), 1);
+                    } else if(lex.accept("default")){
+                        numbers(defaults);
+                        if(defaults.size() != card) lex.error("wrong default size for '" + desc.names[v] + "'");
+                    } else if(lex.accept("(")){
+                        Size row = 0, stride = 1, j = 0;
+                        while(!lex.accept(")")){
+                            if(lex.accept(",")) continue;
+                            if(j == parents.size()) lex.error("too many parent states");
+                            row += stride * stateIndex(parents[j], lex.next());
+                            stride *= desc.states[parents[j]].size();
+                            j++;
+                        }
+                        if(j != parents.size()) lex.error("missing parent states");
+                        numbers(values);
+                        if(values.size() != card) lex.error("wrong row size for '" + desc.names[v] + "'");
+                        std::copy(values.begin(), values.end(), table.begin() + row * card);
+                        set[row] = 1;
+                    } else lex.skipStatement();
+                }
+                for(Size row = 0; row < set.size(); row++){
+                    if(set[row]) continue;
+                    if(defaults.empty()) lex.error("missing rows in the probability of '" + desc.names[v] + "'");
+                    std::copy(defaults.begin(), defaults.end(), table.begin() + row * card);
+                }
+            } else lex.error("unexpected '" + kw + "'");
+        }
+        return desc;
+    }
+
+    BNDescription parse_uai(std::istream& in, const std::string& source){
+        auto lex = _IO_Lexer_(in, source, false);
+        auto desc = BNDescription();
+        if(lex.next() != "BAYES") lex.error("only BAYES networks are supported");
+
+        const auto n = lex.integer();
+        desc.names.reserve(n);
+        desc.states.resize(n);
+        desc.parents.resize(n);
+        desc.tables.resize(n);
+        for(Idx v = 0; v < n; v++){
+            desc.names.push_back("X" + std::to_string(v));
+            const auto card = lex.integer();
+            desc.states[v].reserve(card);
+            for(Size s = 0; s < card; s++) desc.states[v].push_back(std::to_string(s));
+        }
+
+        // the scopes first, then the tables in the same order
+        const auto m = lex.integer();
+        auto scopes = std::vector<std::vector<Idx>>(m);
+        auto owner = std::vector<char>(n, 0);
+        for(auto& scope : scopes){
+            const auto k = lex.integer();
+            if(k == 0) lex.error("empty scope");
+            scope.resize(k);
+            for(auto& x : scope){
+                x = lex.integer();
+                if(x >= n) lex.error("unknown variable " + std::to_string(x));
+            }
+            const auto v = scope.back();
+            if(owner[v]) lex.error("second function of X" + std::to_string(v));
+            owner[v] = 1;
+            desc.parents[v].assign(scope.begin(), scope.end() - 1);
+        }
+
+        auto values = std::vector<double>();
+        for(const auto& scope : scopes){
+            const auto v = scope.back();
+            const auto size = lex.integer();
+            if(size != _IO_cptSize_(desc, v)) lex.error("wrong table size for X" + std::to_string(v));
+            values.resize(size);
+            for(auto& x : values) x = lex.number();
+
+            // scope [p1..pk, v] in the file, [v, p1..pk] in the CPT
+            auto cards = std::vector<Size>(scope.size());
+            auto outPos = std::vector<Size>(scope.size());
+            for(Size j = 0; j < scope.size(); j++){
+                cards[j] = desc.states[scope[j]].size();
+                outPos[j] = j + 1;
+            }
+            outPos.back() = 0;
+            desc.tables[v] = _IO_reorder_(values, cards, outPos, true);
+        }
+        return desc;
+    }
+
+    namespace {
+
+        /**
+         * @brief internal : the elements of an XML document, one at a time. The
+         * prolog, comments, processing instructions and declarations are skipped.
+         */
+        class _IO_Xml_ {
+        public:
+            enum class Kind { Open, Close, Text, End };
+            struct Event {
+                Kind kind;
+                std::string name;  ///< tag name, or the text
+                std::unordered_map<std::string, std::string> attrs;
+                bool empty;        ///< whether an Open tag is self-closing
+            };
+
+        private:
+            _IO_Reader_ _r_;
+
+            static void _unescape_(std::string& s){
+                if(s.find('&') == std::string::npos) return;
+                static const std::pair<const char*, char> entities[] = {{"&amp;", '&'}, {"&lt;", '<'}, {"&gt;", '>'}, {"&quot;", '"'}, {"&apos;", '\''}};
+                auto out = std::string();
+                for(Size i = 0; i < s.size(); ){
+                    bool done = false;
+                    if(s[i] == '&')
+                        for(const auto& e : entities)
+                            if(s.compare(i, std::strlen(e.first), e.first) == 0){
+                                out.push_back(e.second);
+                                i += std::strlen(e.first);
+                                done = true;
+                                break;
+                            }
+                    if(!done) out.push_back(s[i++]);
+                }
+                s.swap(out);
+            }
+
+            void _skipSpaces_(){
+                while(std::isspace(_r_.peek())) _r_.get();
+            }
+
+            /// reads a name, ``s`` holding its first characters if already read
+            std::string _name_(std::string s = std::string()){
+                for(auto c = _r_.peek(); c >= 0 && !std::isspace(c) && c != '>' && c != '/' && c != '='; c = _r_.peek())
+                    s.push_back(static_cast<char>(_r_.get()));
+                if(s.empty()) _r_.error("expected a name");
+                return s;
+            }
+
+            /// skips up to the end ``term`` of a comment, instruction or declaration
+            void _skipTo_(const char* term){
+                const auto len = std::strlen(term);
+                auto tail = std::string();
+                for(;;){
+                    const auto c = _r_.get();
+                    if(c < 0) _r_.error("unterminated markup");
+                    tail.push_back(static_cast<char>(c));
+                    if(tail.size() > len) tail.erase(tail.begin());
+                    if(tail == term) return;
+                }
+            }
+
+        public:
+            _IO_Xml_(std::istream& in, const std::string& source) : _r_(in, source) {}
+
+            Event next(){
+                for(;;){
+                    auto ev = Event{Kind::End, std::string(), {}, false};
+                    auto c = _r_.peek();
+                    if(c < 0) return ev;
+                    if(c != '<'){
+                        ev.kind = Kind::Text;
+                        while((c = _r_.peek()) >= 0 && c != '<') ev.name.push_back(static_cast<char>(_r_.get()));
+                        _unescape_(ev.name);
+                        return ev;
+                    }
+                    _r_.get();
+                    c = _r_.peek();
+                    if(c == '?'){
+                        _skipTo_("?>");
+                        continue;
+                    }
+                    if(c == '!'){
+                        _r_.get();
+                        if(_r_.peek() == '-') _skipTo_("-->");
+                        else _skipTo_(">");
+                        continue;
+                    }
+                    if(c == '/'){
+                        _r_.get();
+                        ev.kind = Kind::Close;
+                        ev.name = _name_();
+                        _skipSpaces_();
+                        if(_r_.get() != '>') _r_.error("expected '>'");
+                        return ev;
+                    }
+                    ev.kind = Kind::Open;
+                    ev.name = _name_();
+                    for(;;){
+                        _skipSpaces_();
+                        c = _r_.get();
+                        if(c == '>') return ev;
+                        if(c == '/'){
+                            if(_r_.get() != '>') _r_.error("expected '>'");
+                            ev.empty = true;
+                            return ev;
+                        }
+                        if(c < 0) _r_.error("unterminated tag");
+                        auto attr = _name_(std::string(1, static_cast<char>(c)));
+                        _skipSpaces_();
+                        if(_r_.get() != '=') _r_.error("expected '='");
+                        _skipSpaces_();
+                        const auto quote = _r_.get();
+                        if(quote != '"' && quote != '\'') _r_.error("expected a quoted value");
+                        auto value = std::string();
+                        for(c = _r_.get(); c != quote; c = _r_.get()){
+                            if(c < 0) _r_.error("unterminated value");
+                            value.push_back(static_cast<char>(c));
+                        }
+                        _unescape_(value);
+                        ev.attrs[attr] = std::move(value);
+                    }
+                }
+            }
+
+            [[noreturn]] void error(const std::string& msg) const {
+                _r_.error(msg);
+            }
+        };
+
+    }
+
+    /// internal : splits ``s`` on blanks
+    static std::vector<std::string> _IO_words_(const std::string& s){
+        auto res = std::vector<std::string>();
+        for(Size i = 0; i < s.size(); ){
+            while(i < s.size() && std::isspace(static_cast<unsigned char>(s[i]))) i++;
+            const auto j = i;
+            while(i < s.size() && !std::isspace(static_cast<unsigned char>(s[i]))) i++;
+            if(j < i) res.emplace_back(s, j, i - j);
+        }
+        return res;
+    }
+
+    BNDescription parse_xdsl(std::istream& in, const std::string& source){
+        using Kind = _IO_Xml_::Kind;
+        auto xml = _IO_Xml_(in, source);
+        auto desc = BNDescription();
+        auto index = std::unordered_map<std::string, Idx>();
+        auto values = std::vector<std::vector<double>>(); // the tables as written, [parents..., v] with v the fastest
+
+        Size nodesDepth = 0; // nesting inside <nodes>
+        Idx cur = 0;
+        bool inCpt = false;
+        auto field = std::string(); // the child of <cpt> whose text is read
+        auto text = std::string();
+
+        for(auto ev = xml.next(); ev.kind != Kind::End; ev = xml.next()){
+            if(ev.kind == Kind::Text){
+                if(!field.empty()) text += ev.name;
+                continue;
+            }
+            if(ev.kind == Kind::Open){
+                if(ev.name == "nodes"){
+                    if(!ev.empty) nodesDepth++;
+                    continue;
+                }
+                if(nodesDepth == 0) continue;
+                if(ev.name == "cpt"){
+                    if(inCpt) xml.error("nested cpt");
+                    const auto it = ev.attrs.find("id");
+                    if(it == ev.attrs.end()) xml.error("cpt without id");
+                    if(index.count(it->second)) xml.error("node '" + it->second + "' declared twice");
+                    cur = static_cast<Idx>(desc.names.size());
+                    index.emplace(it->second, cur);
+                    desc.names.push_back(it->second);
+                    desc.states.emplace_back();
+                    desc.parents.emplace_back();
+                    desc.tables.emplace_back();
+                    values.emplace_back();
+                    inCpt = !ev.empty;
+                } else if(inCpt && ev.name == "state"){
+                    const auto it = ev.attrs.find("id");
+                    if(it == ev.attrs.end()) xml.error("state without id");
+                    desc.states[cur].push_back(it->second);
+                } else if(inCpt && (ev.name == "parents" || ev.name == "probabilities")){
+                    if(!ev.empty) field = ev.name;
+                    text.clear();
+                } else if(!inCpt && ev.name != "submodel"){
+                    xml.error("unsupported node '" + ev.name + "' (only cpt nodes are read)");
+                }
+                continue;
+            }
+            // Close
+            if(ev.name == "nodes" && nodesDepth > 0) nodesDepth--;
+            else if(ev.name == "cpt") inCpt = false;
+            else if(!field.empty() && ev.name == field){
+                if(field == "parents"){
+                    for(const auto& p : _IO_words_(text)){
+                        const auto it = index.find(p);
+                        if(it == index.end()) xml.error("unknown parent '" + p + "' of '" + desc.names[cur] + "'");
+                        desc.parents[cur].push_back(it->second);
+                    }
+                } else {
+                    for(const auto& w : _IO_words_(text)){
+                        char* end = nullptr;
+                        values[cur].push_back(std::strtod(w.c_str(), &end));
+                        if(*end != '\0') xml.error("expected a number, got '" + w + "'");
+                    }
+                }
+                field.clear();
+            }
+        }
+
+        for(Idx v = 0; v < desc.names.size(); v++){
+            if(values[v].empty()) continue;
+            if(values[v].size() != _IO_cptSize_(desc, v)) xml.error("wrong table size for '" + desc.names[v] + "'");
+            const auto k = desc.parents[v].size();
+            auto cards = std::vector<Size>(k + 1);
+            auto outPos = std::vector<Size>(k + 1);
+            for(Size j = 0; j < k; j++){
+                cards[j] = desc.states[desc.parents[v][j]].size();
+                outPos[j] = j + 1;
+            }
+            cards[k] = desc.states[v].size();
+            outPos[k] = 0;
+            desc.tables[v] = _IO_reorder_(values[v], cards, outPos, true);
+        }
+        return desc;
+    }
+
+    BNDescription _IO_parse_file_(const std::string& path){
+        auto in = std::ifstream(path, std::ios::binary);
+        if(!in) GUM_ERROR(IOError, "cannot open " << path)
+
+        const auto dot = path.rfind('.');
+        auto ext = dot == std::string::npos ? std::string() : path.substr(dot + 1);
+        std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c){ return std::tolower(c); });
+        if(ext == "bif") return parse_bif(in, path);
+        if(ext == "uai") return parse_uai(in, path);
+        if(ext == "xdsl") return parse_xdsl(in, path);
+        GUM_ERROR(IOError, "unknown format of " << path << " (expected .bif, .uai or .xdsl)")
+    }
+
+    std::vector<std::pair<std::string, std::vector<std::string>>> parse_latents(std::istream& in, const std::string& source){
+        auto res = std::vector<std::pair<std::string, std::vector<std::string>>>();
+        auto line = std::string();
+        for(Size lineNo = 1; std::getline(in, line); lineNo++){
+            const auto hash = line.find('#');
+            if(hash != std::string::npos) line.resize(hash);
+            const auto colon = line.find(':');
+            if(colon == std::string::npos){
+                if(!_IO_words_(line).empty()) GUM_ERROR(IOError, source << ":" << lineNo << ": expected 'name: children'")
+                continue;
+            }
+            const auto name = _IO_words_(line.substr(0, colon));
+            if(name.size() != 1) GUM_ERROR(IOError, source << ":" << lineNo << ": expected a single latent name")
+            for(auto& c : line) if(c == ',') c = ' ';
+            res.emplace_back(name.front(), _IO_words_(line.substr(colon + 1)));
+        }
+        return res;
+    }
+}
@@ -0,0 +1,164 @@
+#ifndef GUM_BN_LOADERS_H
+#define GUM_BN_LOADERS_H
+
+#include <agrum/BN/BayesNet.h>
+#include <agrum/tools/multidim/instantiation.h>
+#include <istream>
+#include <string>
+#include <vector>
+#include <utility>
+#include <memory>
+
+#include "CausalModel.h"
+
+namespace gum{
+
+    /// latent descriptors as taken by @ref CausalModel : the name of each latent variable and its children
+    using LatentDescriptors = std::vector<std::pair<std::string, std::vector<NodeId>>>;
+
+    /**
+     * @struct BNDescription
+     * @brief Flat description of a Bayesian network read from a file, before
+     * any BayesNet is built: every container is sized once from the file, so
+     * that @ref build_bn can preallocate the network and insert the arcs in a
+     * single batch.
+     *
+     * The variables are indexed from 0 in the order of their declaration. The
+     * table of variable ``i`` ranges over ``[i, parents[i]...]`` with ``i``
+     * varying the fastest (the order of the CPTs of aGrUM).
+     */
+    struct BNDescription {
+        std::vector<std::string> names;                 ///< name of each variable
+        std::vector<std::vector<std::string>> states;   ///< labels of the states of each variable
+        std::vector<std::vector<Idx>> parents;          ///< parents of each variable, in the order of the file
+        std::vector<std::vector<double>> tables;        ///< CPT of each variable, empty if the file gives none
+    };
+
+    /**
+     * @brief Parses a network in the Bayesian Interchange Format
+     * (``variable`` and ``probability`` blocks). Both the ``table`` and the
+     * row syntax ``(s1, s2) p1, p2;`` of the probability blocks are read;
+     * a ``table`` lists the values with the last variable varying the fastest.
+     *
+     * @param in the stream, read once
+     * @param source name of the stream for error messages
+     * @return BNDescription
+     * @throw IOError on a syntax error
+     */
+    BNDescription parse_bif(std::istream& in, const std::string& source = "bif");
+
+    /**
+     * @brief Parses a network in the UAI format (``BAYES`` preamble, one
+     * function per variable whose scope ends with the variable itself). The
+     * variables are named ``X0``, ``X1``... and their states ``0``, ``1``...
+     *
+     * @param in the stream, read once
+     * @param source name of the stream for error messages
+     * @return BNDescription
+     * @throw IOError on a syntax error or a network that is not a BAYES one
+     */
+    BNDescription parse_uai(std::istream& in, const std::string& source = "uai");
+
+    /**
+     * @brief Parses a network in the XDSL format of GeNIe/SMILE. Only the
+     * ``cpt`` nodes are supported (the other kinds of node have no table to
+     * read).
+     *
+     * @param in the stream, read once
+     * @param source name of the stream for error messages
+     * @return BNDescription
+     * @throw IOError on a syntax error or an unsupported node
+     */
+    BNDescription parse_xdsl(std::istream& in, const std::string& source = "xdsl");
+
+    /**
+     * @brief Parses a latent-confounder sidecar: one latent variable per line,
+     * ``name: child1 child2 ...``, blank lines and ``#`` comments being ignored.
+     *
+     * @param in the stream, read once
+     * @param source name of the stream for error messages
+     * @return the name of each latent variable and the names of its children
+     * @throw IOError on a syntax error
+     */
+    std::vector<std::pair<std::string, std::vector<std::string>>> parse_latents(std::istream& in, const std::string& source = "latents");
+
+    /**
+     * @brief Builds the Bayesian network of a description: the variables are
+     * added first, then all the arcs inside a single topology transformation
+     * (the CPTs are reshaped once), then the tables are filled.
+     *
+     * @tparam GUM_SCALAR
+     * @param desc
+     * @return BayesNet<GUM_SCALAR>
+     * @throw InvalidArgument if the parents make a cycle or a table has the wrong size
+     */
+    template<typename GUM_SCALAR>
+    BayesNet<GUM_SCALAR> build_bn(const BNDescription& desc);
+
+    /**
+     * @brief internal : builds the network of ``desc`` (see @ref build_bn)
+     * into ``bn``, an empty network
+     */
+    template<typename GUM_SCALAR>
+    void _IO_build_into_(const BNDescription& desc, BayesNet<GUM_SCALAR>& bn);
+
+    /**
+     * @brief internal : parses the network file ``path``, the format being
+     * given by the extension (see @ref load_bn)
+     * @throw IOError if the file cannot be read or its extension is unknown
+     */
+    BNDescription _IO_parse_file_(const std::string& path);
+
+    /**
+     * @brief Reads a Bayesian network from a ``.bif``, ``.uai`` or ``.xdsl``
+     * file, the format being given by the extension
+     *
+     * @tparam GUM_SCALAR
+     * @param path
+     * @return BayesNet<GUM_SCALAR>
+     * @throw IOError if the file cannot be read or its extension is unknown
+     */
+    template<typename GUM_SCALAR>
+    BayesNet<GUM_SCALAR> load_bn(const std::string& path);
+
+    /**
+     * @brief Reads a latent-confounder sidecar (see @ref parse_latents) and
+     * maps the children to the nodes of ``bn``
+     *
+     * @tparam GUM_SCALAR
+     * @param in
+     * @param bn the observational network
+     * @param source name of the stream for error messages
+     * @return LatentDescriptors
+     * @throw NotFound if a child is not a variable of ``bn``
+     */
+    template<typename GUM_SCALAR>
+    LatentDescriptors read_latents(std::istream& in, const BayesNet<GUM_SCALAR>& bn, const std::string& source = "latents");
+
+    /**
+     * @brief A causal model read from files, with the observational network
+     * it refers to (the model is destroyed first)
+     */
+    template<typename GUM_SCALAR>
+    struct LoadedCausalModel {
+        std::unique_ptr<BayesNet<GUM_SCALAR>> bn;
+        std::unique_ptr<CausalModel<GUM_SCALAR>> model;
+    };
+
+    /**
+     * @brief Builds a causal model from a network file and an optional
+     * latent-confounder sidecar
+     *
+     * @tparam GUM_SCALAR
+     * @param bnPath a ``.bif``, ``.uai`` or ``.xdsl`` file
+     * @param latentPath the sidecar, none if empty
+     * @param keepArcs as in @ref CausalModel
+     * @return LoadedCausalModel<GUM_SCALAR>
+     */
+    template<typename GUM_SCALAR>
+    LoadedCausalModel<GUM_SCALAR> load_causal_model(const std::string& bnPath, const std::string& latentPath = "", bool keepArcs = false);
+}
+
+#include "bnLoaders_tpl.h"
+
+#endif
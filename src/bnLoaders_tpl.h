@@ -0,0 +1,85 @@
+#include "bnLoaders.h"
+
+#include <agrum/tools/variables/labelizedVariable.h>
+#include <fstream>
+
+namespace gum{
+
+    template<typename GUM_SCALAR>
+    BayesNet<GUM_SCALAR> build_bn(const BNDescription& desc){
+        auto bn = BayesNet<GUM_SCALAR>();
+        _IO_build_into_(desc, bn);
+        return bn;
+    }
+
+    template<typename GUM_SCALAR>
+    void _IO_build_into_(const BNDescription& desc, BayesNet<GUM_SCALAR>& bn){
+        const auto n = desc.names.size();
+        auto ids = std::vector<NodeId>(n);
+        for(Idx i = 0; i < n; i++){
+            auto var = LabelizedVariable(desc.names[i], desc.names[i], 0);
+            for(const auto& s : desc.states[i]) var.addLabel(s);
+            ids[i] = bn.add(var);
+        }
+
+        // the CPTs are reshaped once at the end of the transformation, not after each arc
+        bn.beginTopologyTransformation();
+        for(Idx i = 0; i < n; i++)
+            for(const auto& p : desc.parents[i]){
+                try{
+                    bn.addArc(ids[p], ids[i]);
+                }catch(const InvalidDirectedCycle&){ // a malformed description, as a wrong table size
+                    GUM_ERROR(InvalidArgument, "the arc " << desc.names[p] << " -> " << desc.names[i] << " makes a cycle")
+                }
+            }
+        bn.endTopologyTransformation();
+
+        auto inst = Instantiation();
+        for(Idx i = 0; i < n; i++){
+            const auto& table = desc.tables[i];
+            if(table.empty()) continue;
+            // the instantiation follows the order of the table, whatever the order of the CPT
+            inst.clear();
+            inst.add(bn.variable(ids[i]));
+            for(const auto& p : desc.parents[i]) inst.add(bn.variable(ids[p]));
+            if(inst.domainSize() != table.size())
+                GUM_ERROR(InvalidArgument, "wrong table size for " << desc.names[i])
+            const auto& cpt = bn.cpt(ids[i]);
+            Size k = 0;
+            for(inst.setFirst(); !inst.end(); inst.inc()) cpt.set(inst, static_cast<GUM_SCALAR>(table[k++]));
+        }
+    }
+
+    template<typename GUM_SCALAR>
+    BayesNet<GUM_SCALAR> load_bn(const std::string& path){
+        return build_bn<GUM_SCALAR>(_IO_parse_file_(path));
+    }
+
+    template<typename GUM_SCALAR>
+    LatentDescriptors read_latents(std::istream& in, const BayesNet<GUM_SCALAR>& bn, const std::string& source){
+        auto res = LatentDescriptors();
+        for(const auto& lat : parse_latents(in, source)){
+            auto children = std::vector<NodeId>();
+            children.reserve(lat.second.size());
+            for(const auto& c : lat.second) children.push_back(bn.idFromName(c));
+            res.emplace_back(lat.first, std::move(children));
+        }
+        return res;
+    }
+
+    template<typename GUM_SCALAR>
+    LoadedCausalModel<GUM_SCALAR> load_causal_model(const std::string& bnPath, const std::string& latentPath, bool keepArcs){
+        auto res = LoadedCausalModel<GUM_SCALAR>();
+        // built in place : a BayesNet is not cheaply movable, its tables would be copied
+        res.bn = std::make_unique<BayesNet<GUM_SCALAR>>();
+        _IO_build_into_(_IO_parse_file_(bnPath), *res.bn);
+        auto latents = LatentDescriptors();
+        if(!latentPath.empty()){
+            auto in = std::ifstream(latentPath);
+            if(!in) GUM_ERROR(IOError, "cannot open " << latentPath)
+            latents = read_latents(in, *res.bn, latentPath);
+        }
+        res.model = std::make_unique<CausalModel<GUM_SCALAR>>(*res.bn, latents, keepArcs);
+        return res;
+    }
+}
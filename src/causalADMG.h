@@ -0,0 +1,307 @@
+#ifndef GUM_CAUSAL_ADMG_H
+#define GUM_CAUSAL_ADMG_H
+
+#include <agrum/BN/BayesNet.h>
+#include <agrum/tools/core/set.h>
+#include <agrum/tools/core/hashTable.h>
+#include <agrum/tools/graphs/DAG.h>
+#include <agrum/tools/graphs/undiGraph.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "CausalModel.h"
+#include "dSeparation.h"
+#include "doorCriteria.h"
+#include "districtIndex.h"
+#include "mutilatedGraphView.h"
+
+namespace gum{
+
+    /**
+     * @class CausalADMG
+     * @brief Causal model as an acyclic directed mixed graph : the observed
+     * nodes, the directed arcs between them and the bidirected edges
+     * ``a <-> b`` standing for the latent confounders, stored as adjacency
+     * (a @ref DAG and an @ref UndiGraph over the same ids, the ones of the
+     * observational network).
+     *
+     * No latent node is ever stored : the traversals, the ancestors and the
+     * moral graphs only see the observed nodes, and the c-components are the
+     * districts of the bidirected edges, maintained through the edits. The
+     * class implements the DAG-like interface expected by the ``GraphT``
+     * algorithms and the part of the interface of @ref CausalModel used by
+     * the identification algorithm ; @ref reduce_moralize and
+     * @ref proper_backdoor_graph are overloaded so that the d-separation
+     * (m-separation here) and the adjustment criteria take the bidirected
+     * edges into account ; the other d-separation tests and the door
+     * generators run on its @ref canonical_dag.
+     *
+     * @warning the observational network must outlive the ADMG
+     */
+    template<typename GUM_SCALAR>
+    class CausalADMG {
+    private:
+        const BayesNet<GUM_SCALAR>* _ob_BN_;
+        DAG _dag_;                                  ///< the observed nodes and the directed arcs
+        UndiGraph _bidirected_;                     ///< the bidirected edges, over the same nodes
+        HashTable<NodeId, std::string> _names_;
+        HashTable<std::string, NodeId> _ids_;
+        NodeSet _latents_;                          ///< always empty
+        DistrictIndex _districts_;                  ///< the c-components
+        mutable std::shared_ptr<BayesNet<GUM_SCALAR>> _ca_BN_; ///< latent-node form, built by causalBN() only
+
+        /// adds the observed node ``n`` of the observational network
+        void _addNode_(NodeId n);
+
+        /// recomputes the c-components, after a bidirected edge was erased
+        void _rebuildDistricts_();
+
+    public:
+        /**
+         * @brief The ADMG of the observational network : its arcs, and no
+         * bidirected edge
+         */
+        explicit CausalADMG(const BayesNet<GUM_SCALAR>& bn);
+
+        /**
+         * @brief The ADMG of a causal model, from its @ref latentProjection :
+         * an arc ``a -> b`` for every directed path from ``a`` to ``b`` through
+         * latent nodes only, and an edge ``a <-> b`` for every pair of observed
+         * nodes with a common latent ancestor through latent nodes only
+         */
+        explicit CausalADMG(const CausalModel<GUM_SCALAR>& cm);
+        CausalADMG(const CausalADMG<GUM_SCALAR>& other);
+        CausalADMG(CausalADMG<GUM_SCALAR>&& other);
+        ~CausalADMG();
+        CausalADMG() = delete;
+
+        CausalADMG<GUM_SCALAR>& operator=(const CausalADMG<GUM_SCALAR>& other);
+        CausalADMG<GUM_SCALAR>& operator=(CausalADMG<GUM_SCALAR>&& other);
+
+        /**
+         * @brief Returns the causal model in the latent-node form : one latent
+         * variable (with 2 modalities) per bidirected edge, named after its
+         * children
+         *
+         * @return CausalModel over the observational network of the ADMG
+         */
+        CausalModel<GUM_SCALAR> toCausalModel() const;
+
+        /**
+         * @brief Returns the ADMG induced by the nodes of ``nodes``, with the
+         * arcs and bidirected edges between them
+         */
+        CausalADMG<GUM_SCALAR> induced(const NodeSet& nodes) const;
+
+        /// the directed part of the ADMG
+        const DAG& dag() const;
+
+        /// the bidirected part of the ADMG
+        const UndiGraph& bidirected() const;
+
+        /// the nodes
+        const NodeGraphPart& nodes() const;
+
+        /// number of nodes
+        Size size() const;
+
+        /// whether ``n`` is a node of the ADMG
+        bool exists(NodeId n) const;
+
+        /// parents of ``n`` by the directed arcs
+        const NodeSet& parents(NodeId n) const;
+
+        /// children of ``n`` by the directed arcs
+        const NodeSet& children(NodeId n) const;
+
+        /// the nodes linked to ``n`` by a bidirected edge
+        const NodeSet& spouses(NodeId n) const;
+
+        /// whether the arc ``tail -> head`` is in the ADMG
+        bool existsArc(NodeId tail, NodeId head) const;
+
+        /// whether the bidirected edge ``a <-> b`` is in the ADMG
+        bool existsBidirected(NodeId a, NodeId b) const;
+
+        /// the directed arcs
+        const ArcSet& arcs() const;
+
+        /// the bidirected edges
+        const EdgeSet& bidirectedEdges() const;
+
+        /// number of directed arcs
+        Size sizeArcs() const;
+
+        /// number of bidirected edges
+        Size sizeBidirected() const;
+
+        /// ancestors of ``n`` by the directed arcs (``n`` excluded)
+        NodeSet ancestors(NodeId n) const;
+
+        /// descendants of ``n`` by the directed arcs (``n`` excluded)
+        NodeSet descendants(NodeId n) const;
+
+        /**
+         * @brief Add the arc a->b
+         * @throw InvalidDirectedCycle if the arc creates a directed cycle
+         */
+        void addArc(NodeId a, NodeId b);
+
+        /// Erase the arc a->b
+        void eraseArc(NodeId a, NodeId b);
+
+        /// Add the bidirected edge a<->b
+        void addBidirected(NodeId a, NodeId b);
+
+        /// Erase the bidirected edge a<->b
+        void eraseBidirected(NodeId a, NodeId b);
+
+        /// always empty : no latent node is stored
+        const NodeSet& latentVariablesIds() const;
+
+        /// the c-components, maintained through the edits
+        const DistrictIndex& districts() const;
+
+        /// the c-components of the nodes
+        std::vector<NodeSet> cComponents() const;
+
+        /// a mapping from node's id to its name
+        const HashTable<NodeId, std::string>& names() const;
+
+        /**
+         * @param name
+         * @return NodeId
+         * @throw NotFound if no node has this name
+         */
+        NodeId idFromName(const std::string& name) const;
+
+        /**
+         * @brief Returns the causal model in the latent-node form as a
+         * Bayesian network, built at the first call after a change of the
+         * structure (see @ref toCausalModel)
+         * @warning the first call is not thread-safe
+         */
+        const BayesNet<GUM_SCALAR>& causalBN() const;
+
+        /// the observational network
+        const BayesNet<GUM_SCALAR>& observationalBN() const;
+    };
+
+    /**
+     * @brief The moral graph of the ancestral set of ``x``, ``y`` and ``zset``
+     * in an ADMG : every district of the ancestral set together with its
+     * parents is a clique (see @ref reduce_moralize for the DAG-like graphs),
+     * so that @ref isDSep tests the m-separation
+     */
+    template<typename GUM_SCALAR>
+    UndiGraph reduce_moralize(const CausalADMG<GUM_SCALAR>& g, const NodeSet& x, const NodeSet& y, const NodeSet& zset);
+
+    /**
+     * @brief The ADMG without the first arcs of the proper causal paths from
+     * ``X`` to ``Y``, its bidirected edges kept (see @ref proper_backdoor_graph
+     * for the DAG-like graphs)
+     */
+    template<typename GUM_SCALAR>
+    CausalADMG<GUM_SCALAR> proper_backdoor_graph(const CausalADMG<GUM_SCALAR>& g, const NodeSet& X, const NodeSet& Y);
+
+    /**
+     * @brief The DAG of an ADMG in which every bidirected edge ``a <-> b`` is
+     * a latent node parent of ``a`` and ``b`` : the d-separations between
+     * observed nodes in this DAG are the m-separations of the ADMG.
+     *
+     * @param g the ADMG
+     * @param latents receives the latent nodes, numbered from the bound of the observed ones
+     * @return DAG the structure only, no variable is created
+     */
+    template<typename GUM_SCALAR>
+    DAG canonical_dag(const CausalADMG<GUM_SCALAR>& g, NodeSet& latents);
+
+    /**
+     * @brief The @ref canonical_dag of a mutilated ADMG : the arcs of the view,
+     * and a latent parent for every bidirected edge none of whose ends has its
+     * entering arcs removed (an intervention cuts the bidirected edges too)
+     */
+    template<typename GUM_SCALAR>
+    DAG canonical_dag(const MutilatedGraphView<CausalADMG<GUM_SCALAR>>& g, NodeSet& latents);
+
+    /**
+     * @brief The moral graph of a mutilated ADMG for @ref isDSep, built on its
+     * @ref canonical_dag : the latent nodes of the ancestral set are kept
+     */
+    template<typename GUM_SCALAR>
+    UndiGraph reduce_moralize(const MutilatedGraphView<CausalADMG<GUM_SCALAR>>& g, const NodeSet& x, const NodeSet& y, const NodeSet& zset);
+
+    /**
+     * @brief @ref isDSep_parents for an ADMG, tested on its @ref canonical_dag :
+     * a path entering ``sx`` by a bidirected edge is a backdoor path
+     */
+    template<typename GUM_SCALAR>
+    bool isDSep_parents(const CausalADMG<GUM_SCALAR>& g, const NodeSet& sx, const NodeSet& sy, const NodeSet& zset);
+
+    /// @ref isDSep_parents for a mutilated ADMG, tested on its @ref canonical_dag
+    template<typename GUM_SCALAR>
+    bool isDSep_parents(const MutilatedGraphView<CausalADMG<GUM_SCALAR>>& g, const NodeSet& sx, const NodeSet& sy, const NodeSet& zset);
+
+    /// @ref isDSep_tech2_children for an ADMG, tested on its @ref canonical_dag
+    template<typename GUM_SCALAR>
+    bool isDSep_tech2_children(const CausalADMG<GUM_SCALAR>& g, const NodeSet& sx, const NodeSet& sy, const NodeSet& zset);
+
+    /// @ref isDSep_tech2_children for a mutilated ADMG, tested on its @ref canonical_dag
+    template<typename GUM_SCALAR>
+    bool isDSep_tech2_children(const MutilatedGraphView<CausalADMG<GUM_SCALAR>>& g, const NodeSet& sx, const NodeSet& sy, const NodeSet& zset);
+
+    /**
+     * @brief @ref dSep_reduce for an ADMG : the reduction of its @ref canonical_dag,
+     * whose remaining latent nodes are numbered from the bound of the observed ones
+     */
+    template<typename GUM_SCALAR>
+    DAG dSep_reduce(const CausalADMG<GUM_SCALAR>& g, const NodeSet& interest);
+
+    /// @ref dSep_reduce for a mutilated ADMG, on its @ref canonical_dag
+    template<typename GUM_SCALAR>
+    DAG dSep_reduce(const MutilatedGraphView<CausalADMG<GUM_SCALAR>>& g, const NodeSet& interest);
+
+    /**
+     * @brief Generates the minimal adjustment sets of an ADMG (see
+     * @ref adjustment_generator for the DAG-like graphs) : the enumeration
+     * runs on its @ref canonical_dag, the latent nodes being excluded from
+     * the sets.
+     *
+     * @throw InvalidArgument if `causes` or `effects` is empty
+     */
+    template<typename GUM_SCALAR>
+    AdjustmentIterable adjustment_generator(const CausalADMG<GUM_SCALAR>& g, const NodeSet& causes, const NodeSet& effects,
+                                            const NodeSet& not_adj = NodeSet({}));
+
+    /**
+     * @brief Generates the backdoor sets of an ADMG (see @ref backdoor_generator) : 
+     * the enumeration runs on its @ref canonical_dag, the latent nodes being excluded 
+     * from the sets
+     * @warning the enumeration can not be resumed from a checkpoint
+     */
+    template<typename GUM_SCALAR>
+    BackdoorIterable backdoor_generator(const CausalADMG<GUM_SCALAR>& g, NodeId cause, NodeId effect, const NodeSet& not_bd = NodeSet({}));
+
+    /// @ref backdoor_generator under ``constraints`` for an ADMG, on its @ref canonical_dag
+    template<typename GUM_SCALAR>
+    BackdoorIterable backdoor_generator(const CausalADMG<GUM_SCALAR>& g, NodeId cause, NodeId effect, const BackdoorConstraints& constraints);
+
+    /**
+     * @brief Generates the frontdoor sets of an ADMG (see @ref frontdoor_generator) : 
+     * the enumeration runs on its @ref canonical_dag, the latent nodes being excluded 
+     * from the sets
+     * @warning the enumeration can not be resumed from a checkpoint
+     */
+    template<typename GUM_SCALAR>
+    FrontdoorIterable<GUM_SCALAR> frontdoor_generator(const CausalADMG<GUM_SCALAR>& g, NodeId cause, NodeId effect, const NodeSet& not_fd = NodeSet({}));
+
+    /// @ref conditional_frontdoor_generator for an ADMG, on its @ref canonical_dag
+    template<typename GUM_SCALAR>
+    FrontdoorIterable<GUM_SCALAR> conditional_frontdoor_generator(const CausalADMG<GUM_SCALAR>& g, NodeId cause, NodeId effect, 
+                                                                  const NodeSet& knowing, const NodeSet& not_fd = NodeSet({}));
+}
+
+#include "causalADMG_tpl.h"
+
+#endif
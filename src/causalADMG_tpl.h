@@ -0,0 +1,451 @@
+#include "causalADMG.h"
+
+namespace gum{
+
+    template<typename GUM_SCALAR>
+    CausalADMG<GUM_SCALAR>::CausalADMG(const BayesNet<GUM_SCALAR>& bn)
+        : _ob_BN_(&bn), _dag_(), _bidirected_(), _names_(), _ids_(), _latents_(), _districts_(), _ca_BN_(nullptr)
+    {
+        for(const auto& n : bn.nodes()) _addNode_(n);
+        for(const auto& a : bn.arcs()) _dag_.addArc(a.tail(), a.head());
+        GUM_CONSTRUCTOR(CausalADMG)
+    }
+
+    template<typename GUM_SCALAR>
+    CausalADMG<GUM_SCALAR>::CausalADMG(const CausalModel<GUM_SCALAR>& cm)
+        : _ob_BN_(&cm.observationalBN()), _dag_(), _bidirected_(), _names_(), _ids_(), _latents_(), _districts_(),
+          _ca_BN_(nullptr)
+    {
+        const auto pcm = latentProjection(cm);
+        const auto& lat = pcm.latentVariablesIds();
+        for(const auto& n : pcm.nodes())
+            if(!lat.contains(n)) _addNode_(n);
+        for(const auto& a : pcm.arcs())
+            if(!lat.contains(a.tail())) _dag_.addArc(a.tail(), a.head());
+        // the children of a projected latent are observed nodes
+        for(const auto& l : lat){
+            const auto children = std::vector<NodeId>(pcm.children(l).begin(), pcm.children(l).end());
+            for(Size i = 0; i < children.size(); i++)
+                for(Size j = i + 1; j < children.size(); j++) addBidirected(children[i], children[j]);
+        }
+        GUM_CONSTRUCTOR(CausalADMG)
+    }
+
+    template<typename GUM_SCALAR>
+    CausalADMG<GUM_SCALAR>::CausalADMG(const CausalADMG<GUM_SCALAR>& other)
+        : _ob_BN_(other._ob_BN_), _dag_(other._dag_), _bidirected_(other._bidirected_), _names_(other._names_),
+          _ids_(other._ids_), _latents_(), _districts_(other._districts_),
+          _ca_BN_(other._ca_BN_) // the causal BN is never modified, only dropped
+    {
+        GUM_CONS_CPY(CausalADMG)
+    }
+
+    template<typename GUM_SCALAR>
+    CausalADMG<GUM_SCALAR>::CausalADMG(CausalADMG<GUM_SCALAR>&& other)
+        : _ob_BN_(other._ob_BN_), _dag_(std::move(other._dag_)), _bidirected_(std::move(other._bidirected_)),
+          _names_(std::move(other._names_)), _ids_(std::move(other._ids_)), _latents_(),
+          _districts_(std::move(other._districts_)), _ca_BN_(std::move(other._ca_BN_))
+    {
+        GUM_CONS_MOV(CausalADMG)
+    }
+
+    template<typename GUM_SCALAR>
+    CausalADMG<GUM_SCALAR>::~CausalADMG(){
+        GUM_DESTRUCTOR(CausalADMG)
+    }
+
+    template<typename GUM_SCALAR>
+    CausalADMG<GUM_SCALAR>& CausalADMG<GUM_SCALAR>::operator=(const CausalADMG<GUM_SCALAR>& other){
+        GUM_OP_CPY(CausalADMG)
+        if(this == &other) return *this;
+        _ob_BN_ = other._ob_BN_;
+        _dag_ = other._dag_;
+        _bidirected_ = other._bidirected_;
+        _names_ = other._names_;
+        _ids_ = other._ids_;
+        _districts_ = other._districts_;
+        _ca_BN_ = other._ca_BN_;
+        return *this;
+    }
+
+    template<typename GUM_SCALAR>
+    CausalADMG<GUM_SCALAR>& CausalADMG<GUM_SCALAR>::operator=(CausalADMG<GUM_SCALAR>&& other){
+        GUM_OP_MOV(CausalADMG)
+        if(this == &other) return *this;
+        _ob_BN_ = other._ob_BN_;
+        _dag_ = std::move(other._dag_);
+        _bidirected_ = std::move(other._bidirected_);
+        _names_ = std::move(other._names_);
+        _ids_ = std::move(other._ids_);
+        _districts_ = std::move(other._districts_);
+        _ca_BN_ = std::move(other._ca_BN_);
+        return *this;
+    }
+
+    template<typename GUM_SCALAR>
+    void CausalADMG<GUM_SCALAR>::_addNode_(NodeId n){
+        const auto& name = _ob_BN_->variable(n).name();
+        _dag_.addNodeWithId(n);
+        _bidirected_.addNodeWithId(n);
+        _names_.insert(n, name);
+        _ids_.insert(name, n);
+        _districts_.addNode(n);
+    }
+
+    template<typename GUM_SCALAR>
+    void CausalADMG<GUM_SCALAR>::_rebuildDistricts_(){
+        _districts_.clear();
+        for(const auto& n : _dag_.nodes()) _districts_.addNode(n);
+        for(const auto& e : _bidirected_.edges()) _districts_.unite(e.first(), e.second());
+    }
+
+    template<typename GUM_SCALAR>
+    CausalModel<GUM_SCALAR> CausalADMG<GUM_SCALAR>::toCausalModel() const {
+        auto res = CausalModel<GUM_SCALAR>(*_ob_BN_);
+        for(const auto& a : _ob_BN_->arcs())
+            if(!_dag_.existsArc(a.tail(), a.head())) res.eraseCausalArc(a.tail(), a.head());
+        for(const auto& a : _dag_.arcs()) res.addCausalArc(a.tail(), a.head());
+        for(const auto& e : _bidirected_.edges()){
+            auto name = _names_[e.first()] + "<->" + _names_[e.second()];
+            while(_ids_.exists(name)) name += "'";
+            res.addLatentVariable(name, std::vector<NodeId>({e.first(), e.second()}), true);
+        }
+        return res;
+    }
+
+    template<typename GUM_SCALAR>
+    CausalADMG<GUM_SCALAR> CausalADMG<GUM_SCALAR>::induced(const NodeSet& nodes) const {
+        auto res = CausalADMG<GUM_SCALAR>(*this);
+        for(const auto& n : _dag_.nodes()){
+            if(nodes.contains(n)) continue;
+            res._dag_.eraseNode(n);
+            res._bidirected_.eraseNode(n);
+            res._ids_.erase(_names_[n]);
+            res._names_.erase(n);
+        }
+        res._rebuildDistricts_();
+        res._ca_BN_ = nullptr;
+        return res;
+    }
+
+    template<typename GUM_SCALAR>
+    const DAG& CausalADMG<GUM_SCALAR>::dag() const {
+        return _dag_;
+    }
+
+    template<typename GUM_SCALAR>
+    const UndiGraph& CausalADMG<GUM_SCALAR>::bidirected() const {
+        return _bidirected_;
+    }
+
+    template<typename GUM_SCALAR>
+    const NodeGraphPart& CausalADMG<GUM_SCALAR>::nodes() const {
+        return _dag_.nodes();
+    }
+
+    template<typename GUM_SCALAR>
+    Size CausalADMG<GUM_SCALAR>::size() const {
+        return _dag_.size();
+    }
+
+    template<typename GUM_SCALAR>
+    bool CausalADMG<GUM_SCALAR>::exists(NodeId n) const {
+        return _dag_.exists(n);
+    }
+
+    template<typename GUM_SCALAR>
+    const NodeSet& CausalADMG<GUM_SCALAR>::parents(NodeId n) const {
+        return _dag_.parents(n);
+    }
+
+    template<typename GUM_SCALAR>
+    const NodeSet& CausalADMG<GUM_SCALAR>::children(NodeId n) const {
+        return _dag_.children(n);
+    }
+
+    template<typename GUM_SCALAR>
+    const NodeSet& CausalADMG<GUM_SCALAR>::spouses(NodeId n) const {
+        return _bidirected_.neighbours(n);
+    }
+
+    template<typename GUM_SCALAR>
+    bool CausalADMG<GUM_SCALAR>::existsArc(NodeId tail, NodeId head) const {
+        return _dag_.existsArc(tail, head);
+    }
+
+    template<typename GUM_SCALAR>
+    bool CausalADMG<GUM_SCALAR>::existsBidirected(NodeId a, NodeId b) const {
+        return _bidirected_.existsEdge(a, b);
+    }
+
+    template<typename GUM_SCALAR>
+    const ArcSet& CausalADMG<GUM_SCALAR>::arcs() const {
+        return _dag_.arcs();
+    }
+
+    template<typename GUM_SCALAR>
+    const EdgeSet& CausalADMG<GUM_SCALAR>::bidirectedEdges() const {
+        return _bidirected_.edges();
+    }
+
+    template<typename GUM_SCALAR>
+    Size CausalADMG<GUM_SCALAR>::sizeArcs() const {
+        return _dag_.sizeArcs();
+    }
+
+    template<typename GUM_SCALAR>
+    Size CausalADMG<GUM_SCALAR>::sizeBidirected() const {
+        return _bidirected_.sizeEdges();
+    }
+
+    template<typename GUM_SCALAR>
+    NodeSet CausalADMG<GUM_SCALAR>::ancestors(NodeId n) const {
+        auto res = NodeSet();
+        auto stack = std::vector<NodeId>({n});
+        while(!stack.empty()){
+            const auto x = stack.back();
+            stack.pop_back();
+            for(const auto& p : _dag_.parents(x)){
+                if(res.contains(p)) continue;
+                res.insert(p);
+                stack.push_back(p);
+            }
+        }
+        return res;
+    }
+
+    template<typename GUM_SCALAR>
+    NodeSet CausalADMG<GUM_SCALAR>::descendants(NodeId n) const {
+        auto res = NodeSet();
+        auto stack = std::vector<NodeId>({n});
+        while(!stack.empty()){
+            const auto x = stack.back();
+            stack.pop_back();
+            for(const auto& c : _dag_.children(x)){
+                if(res.contains(c)) continue;
+                res.insert(c);
+                stack.push_back(c);
+            }
+        }
+        return res;
+    }
+
+    template<typename GUM_SCALAR>
+    void CausalADMG<GUM_SCALAR>::addArc(NodeId a, NodeId b){
+        _dag_.addArc(a, b);
+        _ca_BN_ = nullptr;
+    }
+
+    template<typename GUM_SCALAR>
+    void CausalADMG<GUM_SCALAR>::eraseArc(NodeId a, NodeId b){
+        _dag_.eraseArc(Arc(a, b));
+        _ca_BN_ = nullptr;
+    }
+
+    template<typename GUM_SCALAR>
+    void CausalADMG<GUM_SCALAR>::addBidirected(NodeId a, NodeId b){
+        if(a == b) GUM_ERROR(InvalidArgument, "no bidirected edge from " << a << " to itself")
+        _bidirected_.addEdge(a, b);
+        _districts_.unite(a, b);
+        _ca_BN_ = nullptr;
+    }
+
+    template<typename GUM_SCALAR>
+    void CausalADMG<GUM_SCALAR>::eraseBidirected(NodeId a, NodeId b){
+        if(!_bidirected_.existsEdge(a, b)) return;
+        _bidirected_.eraseEdge(Edge(a, b));
+        _rebuildDistricts_(); // a union cannot be undone
+        _ca_BN_ = nullptr;
+    }
+
+    template<typename GUM_SCALAR>
+    const NodeSet& CausalADMG<GUM_SCALAR>::latentVariablesIds() const {
+        return _latents_;
+    }
+
+    template<typename GUM_SCALAR>
+    const DistrictIndex& CausalADMG<GUM_SCALAR>::districts() const {
+        return _districts_;
+    }
+
+    template<typename GUM_SCALAR>
+    std::vector<NodeSet> CausalADMG<GUM_SCALAR>::cComponents() const {
+        return _districts_.districts();
+    }
+
+    template<typename GUM_SCALAR>
+    const HashTable<NodeId, std::string>& CausalADMG<GUM_SCALAR>::names() const {
+        return _names_;
+    }
+
+    template<typename GUM_SCALAR>
+    NodeId CausalADMG<GUM_SCALAR>::idFromName(const std::string& name) const {
+        if(!_ids_.exists(name)) GUM_ERROR(NotFound, "no variable named " << name << " in the ADMG")
+        return _ids_[name];
+    }
+
+    template<typename GUM_SCALAR>
+    const BayesNet<GUM_SCALAR>& CausalADMG<GUM_SCALAR>::causalBN() const {
+        if(_ca_BN_ == nullptr)
+            _ca_BN_ = std::make_shared<BayesNet<GUM_SCALAR>>(toCausalModel().causalBN());
+        return *_ca_BN_;
+    }
+
+    template<typename GUM_SCALAR>
+    const BayesNet<GUM_SCALAR>& CausalADMG<GUM_SCALAR>::observationalBN() const {
+        return *_ob_BN_;
+    }
+
+    template<typename GUM_SCALAR>
+    UndiGraph reduce_moralize(const CausalADMG<GUM_SCALAR>& g, const NodeSet& x, const NodeSet& y, const NodeSet& zset){
+        auto anc = x + y + zset;
+        for(const auto& i : x + y + zset) anc += g.ancestors(i);
+
+        auto G = UndiGraph();
+        auto index = DistrictIndex(); // the districts of the ancestral set
+        for(const auto& i : anc){
+            G.addNodeWithId(i);
+            index.addNode(i);
+        }
+        for(const auto& b : anc){
+            for(const auto& a : g.parents(b)) G.addEdge(a, b);
+            for(const auto& s : g.spouses(b))
+                if(anc.contains(s)) index.unite(b, s);
+        }
+
+        for(const auto& d : index.districts()){
+            auto clique = d;
+            for(const auto& n : d) clique += g.parents(n);
+            const auto members = std::vector<NodeId>(clique.begin(), clique.end());
+            for(Size i = 0; i < members.size(); i++)
+                for(Size j = i + 1; j < members.size(); j++) G.addEdge(members[i], members[j]);
+        }
+        return G;
+    }
+
+    template<typename GUM_SCALAR>
+    CausalADMG<GUM_SCALAR> proper_backdoor_graph(const CausalADMG<GUM_SCALAR>& g, const NodeSet& X, const NodeSet& Y){
+        const auto pcp = proper_causal_nodes(g, X, Y);
+        auto res = CausalADMG<GUM_SCALAR>(g);
+        for(const auto& x : X){
+            if(!g.exists(x)) continue;
+            for(const auto& c : g.children(x))
+                if(pcp.contains(c)) res.eraseArc(x, c);
+        }
+        return res;
+    }
+
+    template<typename GUM_SCALAR>
+    DAG canonical_dag(const CausalADMG<GUM_SCALAR>& g, NodeSet& latents){
+        auto res = g.dag();
+        auto next = res.bound();
+        for(const auto& e : g.bidirectedEdges()){
+            res.addNodeWithId(next);
+            res.addArc(next, e.first());
+            res.addArc(next, e.second());
+            latents.insert(next++);
+        }
+        return res;
+    }
+
+    template<typename GUM_SCALAR>
+    DAG canonical_dag(const MutilatedGraphView<CausalADMG<GUM_SCALAR>>& g, NodeSet& latents){
+        auto res = DAG();
+        for(const auto& n : g.nodes()) res.addNodeWithId(n);
+        for(const auto& n : g.nodes())
+            for(const auto& c : g.children(n)) res.addArc(n, c);
+        auto next = res.bound();
+        for(const auto& e : g.graph().bidirectedEdges()){
+            if(g.cutIn().contains(e.first()) || g.cutIn().contains(e.second())) continue;
+            res.addNodeWithId(next);
+            res.addArc(next, e.first());
+            res.addArc(next, e.second());
+            latents.insert(next++);
+        }
+        return res;
+    }
+
+    template<typename GUM_SCALAR>
+    UndiGraph reduce_moralize(const MutilatedGraphView<CausalADMG<GUM_SCALAR>>& g, const NodeSet& x, const NodeSet& y, const NodeSet& zset){
+        auto latents = NodeSet();
+        return reduce_moralize(canonical_dag(g, latents), x, y, zset);
+    }
+
+    template<typename GUM_SCALAR>
+    bool isDSep_parents(const CausalADMG<GUM_SCALAR>& g, const NodeSet& sx, const NodeSet& sy, const NodeSet& zset){
+        auto latents = NodeSet();
+        return isDSep_parents(canonical_dag(g, latents), sx, sy, zset);
+    }
+
+    template<typename GUM_SCALAR>
+    bool isDSep_parents(const MutilatedGraphView<CausalADMG<GUM_SCALAR>>& g, const NodeSet& sx, const NodeSet& sy, const NodeSet& zset){
+        auto latents = NodeSet();
+        return isDSep_parents(canonical_dag(g, latents), sx, sy, zset);
+    }
+
+    template<typename GUM_SCALAR>
+    bool isDSep_tech2_children(const CausalADMG<GUM_SCALAR>& g, const NodeSet& sx, const NodeSet& sy, const NodeSet& zset){
+        auto latents = NodeSet();
+        return isDSep_tech2_children(canonical_dag(g, latents), sx, sy, zset);
+    }
+
+    template<typename GUM_SCALAR>
+    bool isDSep_tech2_children(const MutilatedGraphView<CausalADMG<GUM_SCALAR>>& g, const NodeSet& sx, const NodeSet& sy, const NodeSet& zset){
+        auto latents = NodeSet();
+        return isDSep_tech2_children(canonical_dag(g, latents), sx, sy, zset);
+    }
+
+    template<typename GUM_SCALAR>
+    DAG dSep_reduce(const CausalADMG<GUM_SCALAR>& g, const NodeSet& interest){
+        auto latents = NodeSet();
+        return dSep_reduce(canonical_dag(g, latents), interest);
+    }
+
+    template<typename GUM_SCALAR>
+    DAG dSep_reduce(const MutilatedGraphView<CausalADMG<GUM_SCALAR>>& g, const NodeSet& interest){
+        auto latents = NodeSet();
+        return dSep_reduce(canonical_dag(g, latents), interest);
+    }
+
+    template<typename GUM_SCALAR>
+    AdjustmentIterable adjustment_generator(const CausalADMG<GUM_SCALAR>& g, const NodeSet& causes, const NodeSet& effects,
+                                            const NodeSet& not_adj){
+        auto latents = NodeSet();
+        const auto dag = canonical_dag(g, latents);
+        // the iterator keeps its own reduced graph, not ``dag``
+        return adjustment_generator(dag, causes, effects, not_adj + latents);
+    }
+
+    template<typename GUM_SCALAR>
+    BackdoorIterable backdoor_generator(const CausalADMG<GUM_SCALAR>& g, NodeId cause, NodeId effect, const NodeSet& not_bd){
+        auto constraints = BackdoorConstraints();
+        constraints.forbidden = not_bd;
+        return backdoor_generator(g, cause, effect, constraints);
+    }
+
+    template<typename GUM_SCALAR>
+    BackdoorIterable backdoor_generator(const CausalADMG<GUM_SCALAR>& g, NodeId cause, NodeId effect, const BackdoorConstraints& constraints){
+        auto latents = NodeSet();
+        const auto dag = canonical_dag(g, latents);
+        auto cst = constraints;
+        cst.forbidden += latents;
+        // the iterator keeps its own reduced graph, not ``dag``
+        return _BD_generator_(dag, cause, effect, cst, structural_fingerprint(dag), nullptr);
+    }
+
+    template<typename GUM_SCALAR>
+    FrontdoorIterable<GUM_SCALAR> frontdoor_generator(const CausalADMG<GUM_SCALAR>& g, NodeId cause, NodeId effect, const NodeSet& not_fd){
+        auto latents = NodeSet();
+        const auto dag = canonical_dag(g, latents);
+        return _FD_generator_<GUM_SCALAR>(dag, cause, effect, BackdoorReachIndex(dag, NodeSet({cause})), 
+                                          not_fd + latents, structural_fingerprint(dag), nullptr);
+    }
+
+    template<typename GUM_SCALAR>
+    FrontdoorIterable<GUM_SCALAR> conditional_frontdoor_generator(const CausalADMG<GUM_SCALAR>& g, NodeId cause, NodeId effect, 
+                                                                  const NodeSet& knowing, const NodeSet& not_fd){
+        auto latents = NodeSet();
+        const auto dag = canonical_dag(g, latents);
+        return _FD_conditional_generator_<GUM_SCALAR>(dag, cause, effect, knowing, not_fd + latents, structural_fingerprint(dag), nullptr);
+    }
+}
@@ -0,0 +1,100 @@
+#ifndef GUM_CAUSAL_MODEL_PUBLISHER_H
+#define GUM_CAUSAL_MODEL_PUBLISHER_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <cstdint>
+
+#include "CausalModel.h"
+
+namespace gum{
+
+    /// an immutable version of a causal model, shared by the threads querying it
+    template<typename GUM_SCALAR>
+    using CausalModelVersion = std::shared_ptr<const CausalModel<GUM_SCALAR>>;
+
+    /**
+     * @brief Returns an immutable copy of ``cm`` that any number of threads can
+     * query concurrently (the parts of the model built on first use, as the
+     * causal network, are built once under a ``std::call_once``).
+     *
+     * @param cm the causal model
+     * @return CausalModelVersion<GUM_SCALAR>
+     * @warning the observational network of ``cm`` is shared, not copied : it
+     * must outlive the version and must not change
+     */
+    template<typename GUM_SCALAR>
+    CausalModelVersion<GUM_SCALAR> freeze(const CausalModel<GUM_SCALAR>& cm);
+
+    /**
+     * @class CausalModelPublisher
+     * @brief Publishes the successive versions of a causal model in the
+     * read-copy-update fashion.
+     *
+     * Readers @ref acquire the current version (an atomic load of a shared
+     * pointer, never blocked by a writer) and query it as long as they want.
+     * The number of a version is published with it, in the same atomic
+     * object, so a reader never sees a model with the number of another one.
+     * Writers build the next version on a copy of the current one and
+     * publish it with an atomic store ; a replaced version is reclaimed when
+     * the last reader holding it releases it. Writers are serialized with
+     * each other so that no update is lost.
+     */
+    template<typename GUM_SCALAR>
+    class CausalModelPublisher {
+    public:
+        /// a published version and its number
+        struct Published {
+            CausalModelVersion<GUM_SCALAR> model;
+            uint64_t number;
+        };
+
+    private:
+        std::atomic<std::shared_ptr<const Published>> _current_;
+        std::mutex _writers_;
+
+        /// publishes ``version`` with the number following the current one (the writers being locked)
+        void _store_(CausalModelVersion<GUM_SCALAR> version);
+
+    public:
+        /**
+         * @brief Publishes a frozen copy of ``cm`` as the version 0
+         */
+        explicit CausalModelPublisher(const CausalModel<GUM_SCALAR>& cm);
+        CausalModelPublisher(const CausalModelPublisher<GUM_SCALAR>&) = delete;
+        CausalModelPublisher<GUM_SCALAR>& operator=(const CausalModelPublisher<GUM_SCALAR>&) = delete;
+        ~CausalModelPublisher();
+
+        /// the current version, valid as long as the returned pointer is held
+        CausalModelVersion<GUM_SCALAR> acquire() const;
+
+        /// the current version with its number, read in one atomic load
+        std::shared_ptr<const Published> acquirePublished() const;
+
+        /// the number of the current version (incremented by each publication)
+        uint64_t version() const;
+
+        /**
+         * @brief Publishes a frozen copy of ``cm`` as the next version
+         * @return CausalModelVersion<GUM_SCALAR> the published version
+         */
+        CausalModelVersion<GUM_SCALAR> publish(const CausalModel<GUM_SCALAR>& cm);
+
+        /**
+         * @brief Applies ``edit`` to a copy of the current version and
+         * publishes the result ; the readers of the current version are not
+         * affected
+         *
+         * @tparam Edit callable taking a ``CausalModel<GUM_SCALAR>&``
+         * @param edit the modification
+         * @return CausalModelVersion<GUM_SCALAR> the published version
+         */
+        template<typename Edit>
+        CausalModelVersion<GUM_SCALAR> update(Edit&& edit);
+    };
+}
+
+#include "causalModelPublisher_tpl.h"
+
+#endif
@@ -0,0 +1,61 @@
+#include "causalModelPublisher.h"
+
+namespace gum{
+
+    template<typename GUM_SCALAR>
+    CausalModelVersion<GUM_SCALAR> freeze(const CausalModel<GUM_SCALAR>& cm){
+        return std::make_shared<const CausalModel<GUM_SCALAR>>(cm);
+    }
+
+    template<typename GUM_SCALAR>
+    CausalModelPublisher<GUM_SCALAR>::CausalModelPublisher(const CausalModel<GUM_SCALAR>& cm)
+        : _current_(std::make_shared<const Published>(Published{freeze(cm), 0})), _writers_()
+    {
+        GUM_CONSTRUCTOR(CausalModelPublisher)
+    }
+
+    template<typename GUM_SCALAR>
+    CausalModelPublisher<GUM_SCALAR>::~CausalModelPublisher(){
+        GUM_DESTRUCTOR(CausalModelPublisher)
+    }
+
+    template<typename GUM_SCALAR>
+    void CausalModelPublisher<GUM_SCALAR>::_store_(CausalModelVersion<GUM_SCALAR> version){
+        const auto number = _current_.load(std::memory_order_relaxed)->number + 1;
+        _current_.store(std::make_shared<const Published>(Published{std::move(version), number}), std::memory_order_release);
+    }
+
+    template<typename GUM_SCALAR>
+    CausalModelVersion<GUM_SCALAR> CausalModelPublisher<GUM_SCALAR>::acquire() const {
+        return acquirePublished()->model;
+    }
+
+    template<typename GUM_SCALAR>
+    std::shared_ptr<const typename CausalModelPublisher<GUM_SCALAR>::Published> CausalModelPublisher<GUM_SCALAR>::acquirePublished() const {
+        return _current_.load(std::memory_order_acquire);
+    }
+
+    template<typename GUM_SCALAR>
+    uint64_t CausalModelPublisher<GUM_SCALAR>::version() const {
+        return acquirePublished()->number;
+    }
+
+    template<typename GUM_SCALAR>
+    CausalModelVersion<GUM_SCALAR> CausalModelPublisher<GUM_SCALAR>::publish(const CausalModel<GUM_SCALAR>& cm){
+        auto next = freeze(cm);
+        const auto lock = std::lock_guard<std::mutex>(_writers_);
+        _store_(next);
+        return next;
+    }
+
+    template<typename GUM_SCALAR>
+    template<typename Edit>
+    CausalModelVersion<GUM_SCALAR> CausalModelPublisher<GUM_SCALAR>::update(Edit&& edit){
+        const auto lock = std::lock_guard<std::mutex>(_writers_);
+        auto copy = CausalModel<GUM_SCALAR>(*acquire());
+        edit(copy);
+        auto next = freeze(copy);
+        _store_(next);
+        return next;
+    }
+}
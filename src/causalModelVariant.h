@@ -0,0 +1,147 @@
+#ifndef GUM_CAUSAL_MODEL_VARIANT_H
+#define GUM_CAUSAL_MODEL_VARIANT_H
+
+#include <agrum/BN/BayesNet.h>
+#include <agrum/BN/IBayesNet.h>
+#include <agrum/tools/core/hashTable.h>
+#include <agrum/tools/multidim/potential.h>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "CausalModel.h"
+
+namespace gum{
+
+    /**
+     * @class VariantBayesNet
+     * @brief Read-only Bayesian network delegating to a base network : the
+     * table of a node is the one of the overlay if it has one, the one of
+     * the base otherwise, looked up at each call.
+     *
+     * The variables come from the base. The structure is the only thing built :
+     * the DAG of the base is copied, in O(|V|+|E|), the inference reading it
+     * through the non virtual IBayesNet::dag(). No table is copied and no
+     * listener is registered on the base, so any number of views can be built
+     * and used concurrently.
+     *
+     * @warning the base and the overlay must outlive the view
+     */
+    template<typename GUM_SCALAR>
+    class VariantBayesNet : public IBayesNet<GUM_SCALAR> {
+    private:
+        const IBayesNet<GUM_SCALAR>& _base_;
+        const HashTable<NodeId, std::shared_ptr<const Potential<GUM_SCALAR>>>& _overlay_;
+
+    public:
+        /**
+         * @param base the network whose variables, structure and tables are used
+         * @param overlay the tables replacing the ones of ``base``
+         */
+        VariantBayesNet(const IBayesNet<GUM_SCALAR>& base,
+                        const HashTable<NodeId, std::shared_ptr<const Potential<GUM_SCALAR>>>& overlay);
+        VariantBayesNet(const VariantBayesNet<GUM_SCALAR>&) = delete;
+        VariantBayesNet<GUM_SCALAR>& operator=(const VariantBayesNet<GUM_SCALAR>&) = delete;
+        ~VariantBayesNet();
+
+        /// the table of ``id`` in the overlay, in the base otherwise
+        const Potential<GUM_SCALAR>& cpt(NodeId id) const final;
+
+        /// the variables of the base
+        const VariableNodeMap& variableNodeMap() const final;
+
+        const DiscreteVariable& variable(NodeId id) const final;
+
+        NodeId nodeId(const DiscreteVariable& var) const final;
+
+        NodeId idFromName(const std::string& name) const final;
+
+        const DiscreteVariable& variableFromName(const std::string& name) const final;
+    };
+
+    /**
+     * @class CausalModelVariant
+     * @brief Copy-on-write variant of a causal model (a what-if or a
+     * counterfactual twin) : it shares the structure and every table of its
+     * base, and only stores the tables it overrides in an overlay.
+     *
+     * Creating, copying and dropping a variant costs O(size of the overridden
+     * tables) ; a copy shares the overridden tables of the original until one
+     * of them overrides the table again. The inference reads through the
+     * overlay (see @ref observationalBN) and the base is never written : the
+     * first call to @ref observationalBN of a variant (or of a copy) copies
+     * the structure of the base once, in O(|V|+|E|). Overriding or restoring
+     * a table costs O(1) beyond the copy of the table.
+     *
+     * @warning ``cm`` (and its observational network) must outlive the variant
+     * and its tables must not change while the variant is used
+     */
+    template<typename GUM_SCALAR>
+    class CausalModelVariant {
+    private:
+        const CausalModel<GUM_SCALAR>* _base_;
+        HashTable<NodeId, std::shared_ptr<const Potential<GUM_SCALAR>>> _overlay_; ///< the overridden tables
+        mutable std::unique_ptr<VariantBayesNet<GUM_SCALAR>> _bn_; ///< built by observationalBN() only, over _overlay_
+        mutable std::unique_ptr<std::once_flag> _bnOnce_;          ///< guards the build of _bn_
+
+    public:
+        /**
+         * @brief The variant of ``cm`` overriding no table
+         */
+        explicit CausalModelVariant(const CausalModel<GUM_SCALAR>& cm);
+        CausalModelVariant(const CausalModelVariant<GUM_SCALAR>& other);
+        CausalModelVariant(CausalModelVariant<GUM_SCALAR>&& other);
+        ~CausalModelVariant();
+        CausalModelVariant() = delete;
+
+        CausalModelVariant<GUM_SCALAR>& operator=(const CausalModelVariant<GUM_SCALAR>& other);
+        CausalModelVariant<GUM_SCALAR>& operator=(CausalModelVariant<GUM_SCALAR>&& other);
+
+        /// the base causal model (its structure is the one of the variant)
+        const CausalModel<GUM_SCALAR>& model() const;
+
+        /**
+         * @param id a node of the observational network
+         * @return const Potential<GUM_SCALAR>& the table of ``id`` in the variant
+         */
+        const Potential<GUM_SCALAR>& cpt(NodeId id) const;
+
+        /// the table of the variable ``name`` in the variant
+        const Potential<GUM_SCALAR>& cpt(const std::string& name) const;
+
+        /**
+         * @brief Overrides the table of ``id`` with the values of ``pot``
+         *
+         * @param id a node of the observational network
+         * @param pot a potential over the variables of the table of ``id``
+         * @throw InvalidArgument if ``pot`` is not over these variables
+         */
+        void override(NodeId id, const Potential<GUM_SCALAR>& pot);
+
+        /// overrides the table of the variable ``name``
+        void override(const std::string& name, const Potential<GUM_SCALAR>& pot);
+
+        /// restores the table of ``id`` in the base
+        void restore(NodeId id);
+
+        /// whether the table of ``id`` is overridden
+        bool isOverridden(NodeId id) const;
+
+        /// the nodes whose table is overridden
+        NodeSet overridden() const;
+
+        /**
+         * @brief Returns the observational network of the variant : a view of
+         * the one of the base reading its tables through the overlay (see
+         * @ref VariantBayesNet). It is built once, at the first call, in
+         * O(|V|+|E|), and follows the later overrides.
+         * @warning a table must not be overridden or restored while an
+         * inference on the view is running
+         */
+        const IBayesNet<GUM_SCALAR>& observationalBN() const;
+    };
+}
+
+#include "causalModelVariant_tpl.h"
+
+#endif
@@ -0,0 +1,162 @@
+#include "causalModelVariant.h"
+
+namespace gum{
+
+    template<typename GUM_SCALAR>
+    VariantBayesNet<GUM_SCALAR>::VariantBayesNet(
+        const IBayesNet<GUM_SCALAR>& base,
+        const HashTable<NodeId, std::shared_ptr<const Potential<GUM_SCALAR>>>& overlay)
+        : IBayesNet<GUM_SCALAR>(), _base_(base), _overlay_(overlay)
+    {
+        this->dag_ = base.dag();
+        GUM_CONSTRUCTOR(VariantBayesNet)
+    }
+
+    template<typename GUM_SCALAR>
+    VariantBayesNet<GUM_SCALAR>::~VariantBayesNet(){
+        GUM_DESTRUCTOR(VariantBayesNet)
+    }
+
+    template<typename GUM_SCALAR>
+    const Potential<GUM_SCALAR>& VariantBayesNet<GUM_SCALAR>::cpt(NodeId id) const {
+        if(_overlay_.exists(id)) return *_overlay_[id];
+        return _base_.cpt(id);
+    }
+
+    template<typename GUM_SCALAR>
+    const VariableNodeMap& VariantBayesNet<GUM_SCALAR>::variableNodeMap() const {
+        return _base_.variableNodeMap();
+    }
+
+    template<typename GUM_SCALAR>
+    const DiscreteVariable& VariantBayesNet<GUM_SCALAR>::variable(NodeId id) const {
+        return _base_.variable(id);
+    }
+
+    template<typename GUM_SCALAR>
+    NodeId VariantBayesNet<GUM_SCALAR>::nodeId(const DiscreteVariable& var) const {
+        return _base_.nodeId(var);
+    }
+
+    template<typename GUM_SCALAR>
+    NodeId VariantBayesNet<GUM_SCALAR>::idFromName(const std::string& name) const {
+        return _base_.idFromName(name);
+    }
+
+    template<typename GUM_SCALAR>
+    const DiscreteVariable& VariantBayesNet<GUM_SCALAR>::variableFromName(const std::string& name) const {
+        return _base_.variableFromName(name);
+    }
+
+    template<typename GUM_SCALAR>
+    CausalModelVariant<GUM_SCALAR>::CausalModelVariant(const CausalModel<GUM_SCALAR>& cm)
+        : _base_(&cm), _overlay_(), _bn_(nullptr), _bnOnce_(std::make_unique<std::once_flag>())
+    {
+        GUM_CONSTRUCTOR(CausalModelVariant)
+    }
+
+    template<typename GUM_SCALAR>
+    CausalModelVariant<GUM_SCALAR>::CausalModelVariant(const CausalModelVariant<GUM_SCALAR>& other)
+        : _base_(other._base_), _overlay_(other._overlay_), _bn_(nullptr), _bnOnce_(std::make_unique<std::once_flag>())
+    {
+        GUM_CONS_CPY(CausalModelVariant)
+    }
+
+    template<typename GUM_SCALAR>
+    CausalModelVariant<GUM_SCALAR>::CausalModelVariant(CausalModelVariant<GUM_SCALAR>&& other)
+        // the view of ``other`` reads its overlay : it is not taken
+        : _base_(other._base_), _overlay_(std::move(other._overlay_)), _bn_(nullptr), _bnOnce_(std::make_unique<std::once_flag>())
+    {
+        GUM_CONS_MOV(CausalModelVariant)
+    }
+
+    template<typename GUM_SCALAR>
+    CausalModelVariant<GUM_SCALAR>::~CausalModelVariant(){
+        GUM_DESTRUCTOR(CausalModelVariant)
+    }
+
+    template<typename GUM_SCALAR>
+    CausalModelVariant<GUM_SCALAR>& CausalModelVariant<GUM_SCALAR>::operator=(const CausalModelVariant<GUM_SCALAR>& other){
+        GUM_OP_CPY(CausalModelVariant)
+        if(this == &other) return *this;
+        _base_ = other._base_;
+        _overlay_ = other._overlay_;
+        _bn_ = nullptr;
+        _bnOnce_ = std::make_unique<std::once_flag>();
+        return *this;
+    }
+
+    template<typename GUM_SCALAR>
+    CausalModelVariant<GUM_SCALAR>& CausalModelVariant<GUM_SCALAR>::operator=(CausalModelVariant<GUM_SCALAR>&& other){
+        GUM_OP_MOV(CausalModelVariant)
+        if(this == &other) return *this;
+        _base_ = other._base_;
+        _overlay_ = std::move(other._overlay_);
+        _bn_ = nullptr;
+        _bnOnce_ = std::make_unique<std::once_flag>();
+        return *this;
+    }
+
+    template<typename GUM_SCALAR>
+    const CausalModel<GUM_SCALAR>& CausalModelVariant<GUM_SCALAR>::model() const {
+        return *_base_;
+    }
+
+    template<typename GUM_SCALAR>
+    const Potential<GUM_SCALAR>& CausalModelVariant<GUM_SCALAR>::cpt(NodeId id) const {
+        if(_overlay_.exists(id)) return *_overlay_[id];
+        return _base_->observationalBN().cpt(id);
+    }
+
+    template<typename GUM_SCALAR>
+    const Potential<GUM_SCALAR>& CausalModelVariant<GUM_SCALAR>::cpt(const std::string& name) const {
+        return cpt(_base_->observationalBN().idFromName(name));
+    }
+
+    template<typename GUM_SCALAR>
+    void CausalModelVariant<GUM_SCALAR>::override(NodeId id, const Potential<GUM_SCALAR>& pot){
+        const auto& base = _base_->observationalBN().cpt(id);
+        if(pot.nbrDim() != base.nbrDim())
+            GUM_ERROR(InvalidArgument, "the potential is not over the variables of the table of " << id)
+        for(const auto v : base.variablesSequence())
+            if(!pot.contains(*v))
+                GUM_ERROR(InvalidArgument, "the potential is not over the variables of the table of " << id)
+
+        // a new table, so that the variants sharing the current one are not affected
+        auto table = std::make_shared<Potential<GUM_SCALAR>>(base);
+        table->fillWith(pot);
+        if(_overlay_.exists(id)) _overlay_[id] = std::move(table);
+        else _overlay_.insert(id, std::move(table));
+    }
+
+    template<typename GUM_SCALAR>
+    void CausalModelVariant<GUM_SCALAR>::override(const std::string& name, const Potential<GUM_SCALAR>& pot){
+        override(_base_->observationalBN().idFromName(name), pot);
+    }
+
+    template<typename GUM_SCALAR>
+    void CausalModelVariant<GUM_SCALAR>::restore(NodeId id){
+        if(!_overlay_.exists(id)) return;
+        _overlay_.erase(id);
+    }
+
+    template<typename GUM_SCALAR>
+    bool CausalModelVariant<GUM_SCALAR>::isOverridden(NodeId id) const {
+        return _overlay_.exists(id);
+    }
+
+    template<typename GUM_SCALAR>
+    NodeSet CausalModelVariant<GUM_SCALAR>::overridden() const {
+        auto res = NodeSet();
+        for(const auto& entry : _overlay_) res.insert(entry.first);
+        return res;
+    }
+
+    template<typename GUM_SCALAR>
+    const IBayesNet<GUM_SCALAR>& CausalModelVariant<GUM_SCALAR>::observationalBN() const {
+        std::call_once(*_bnOnce_, [this](){
+            _bn_ = std::make_unique<VariantBayesNet<GUM_SCALAR>>(_base_->observationalBN(), _overlay_);
+        });
+        return *_bn_;
+    }
+}
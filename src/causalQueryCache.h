@@ -0,0 +1,92 @@
+#ifndef GUM_CAUSAL_QUERY_CACHE_H
+#define GUM_CAUSAL_QUERY_CACHE_H
+
+#include <agrum/tools/core/set.h>
+#include <agrum/tools/core/hashTable.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "CausalModel.h"
+
+namespace gum{
+
+    /**
+     * @class CausalQueryCache
+     * @brief Cache of the results of queries on a causal model (an
+     * identification, an adjustment set, an evaluated potential...), each
+     * kept with its dependency footprint (see @ref CausalModel::footprint) :
+     * an edit of the model only invalidates the results whose footprint it
+     * touches, the others are still served.
+     *
+     * A result is keyed by a string describing the query (its kind and its
+     * variables) and recorded with the nodes it involves ; a stale result is
+     * dropped when it is looked up, or by @ref prune.
+     *
+     * @tparam Value the type of the results
+     * @warning the footprint only covers the structure : a result depending
+     * on the tables of the observational network (an evaluated potential)
+     * must be dropped with @ref clear when they change
+     * @warning ``cm`` must outlive the cache
+     */
+    template<typename GUM_SCALAR, typename Value>
+    class CausalQueryCache {
+    private:
+        const CausalModel<GUM_SCALAR>& _cm_;
+        HashTable<std::string, std::pair<CausalFootprint, Value>> _entries_;
+
+    public:
+        explicit CausalQueryCache(const CausalModel<GUM_SCALAR>& cm);
+        CausalQueryCache(const CausalQueryCache<GUM_SCALAR, Value>&) = delete;
+        CausalQueryCache<GUM_SCALAR, Value>& operator=(const CausalQueryCache<GUM_SCALAR, Value>&) = delete;
+        ~CausalQueryCache();
+
+        /// the causal model of the cache
+        const CausalModel<GUM_SCALAR>& model() const;
+
+        /**
+         * @brief Returns the result of the query ``key`` if it is still valid
+         *
+         * @param key the query
+         * @return const Value* nullptr if the result is unknown or stale (then dropped)
+         */
+        const Value* find(const std::string& key);
+
+        /**
+         * @brief Records the result of the query ``key``, depending on the
+         * nodes of ``seeds``
+         *
+         * @param key the query
+         * @param seeds the nodes of the query
+         * @param value its result
+         * @return const Value& the recorded result
+         */
+        const Value& insert(const std::string& key, const NodeSet& seeds, Value value);
+
+        /**
+         * @brief Returns the result of the query ``key``, computed by
+         * ``compute`` if it is unknown or stale
+         *
+         * @tparam Compute callable returning a ``Value``
+         * @param key the query
+         * @param seeds the nodes of the query
+         * @param compute the computation of the result
+         * @return const Value& the result
+         */
+        template<typename Compute>
+        const Value& get(const std::string& key, const NodeSet& seeds, Compute&& compute);
+
+        /// drops the stale results
+        void prune();
+
+        /// drops all the results
+        void clear();
+
+        /// number of results recorded (stale ones included)
+        Size size() const;
+    };
+}
+
+#include "causalQueryCache_tpl.h"
+
+#endif
@@ -0,0 +1,62 @@
+#include "causalQueryCache.h"
+
+namespace gum{
+
+    template<typename GUM_SCALAR, typename Value>
+    CausalQueryCache<GUM_SCALAR, Value>::CausalQueryCache(const CausalModel<GUM_SCALAR>& cm)
+        : _cm_(cm), _entries_()
+    {
+        GUM_CONSTRUCTOR(CausalQueryCache)
+    }
+
+    template<typename GUM_SCALAR, typename Value>
+    CausalQueryCache<GUM_SCALAR, Value>::~CausalQueryCache(){
+        GUM_DESTRUCTOR(CausalQueryCache)
+    }
+
+    template<typename GUM_SCALAR, typename Value>
+    const CausalModel<GUM_SCALAR>& CausalQueryCache<GUM_SCALAR, Value>::model() const {
+        return _cm_;
+    }
+
+    template<typename GUM_SCALAR, typename Value>
+    const Value* CausalQueryCache<GUM_SCALAR, Value>::find(const std::string& key){
+        if(!_entries_.exists(key)) return nullptr;
+        const auto& entry = _entries_[key];
+        if(_cm_.isUpToDate(entry.first)) return &entry.second;
+        _entries_.erase(key);
+        return nullptr;
+    }
+
+    template<typename GUM_SCALAR, typename Value>
+    const Value& CausalQueryCache<GUM_SCALAR, Value>::insert(const std::string& key, const NodeSet& seeds, Value value){
+        if(_entries_.exists(key)) _entries_.erase(key);
+        _entries_.insert(key, std::make_pair(_cm_.footprint(seeds), std::move(value)));
+        return _entries_[key].second;
+    }
+
+    template<typename GUM_SCALAR, typename Value>
+    template<typename Compute>
+    const Value& CausalQueryCache<GUM_SCALAR, Value>::get(const std::string& key, const NodeSet& seeds, Compute&& compute){
+        if(const auto* res = find(key)) return *res;
+        return insert(key, seeds, compute());
+    }
+
+    template<typename GUM_SCALAR, typename Value>
+    void CausalQueryCache<GUM_SCALAR, Value>::prune(){
+        auto stale = std::vector<std::string>();
+        for(const auto& entry : _entries_)
+            if(!_cm_.isUpToDate(entry.second.first)) stale.push_back(entry.first);
+        for(const auto& key : stale) _entries_.erase(key);
+    }
+
+    template<typename GUM_SCALAR, typename Value>
+    void CausalQueryCache<GUM_SCALAR, Value>::clear(){
+        _entries_.clear();
+    }
+
+    template<typename GUM_SCALAR, typename Value>
+    Size CausalQueryCache<GUM_SCALAR, Value>::size() const {
+        return _entries_.size();
+    }
+}
@@ -0,0 +1,382 @@
+#include "causalSnapshot.h"
+
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace gum{
+
+    /// internal : the sections of a snapshot, in the order of the file
+    enum _SNAP_Section_ : int {
+        _SNAP_EXISTS_, _SNAP_CHILD_OFFSETS_, _SNAP_CHILDREN_, _SNAP_PARENT_OFFSETS_, _SNAP_PARENTS_,
+        _SNAP_NAME_OFFSETS_, _SNAP_NAMES_, _SNAP_LABEL_STARTS_, _SNAP_LABEL_OFFSETS_, _SNAP_LABELS_,
+        _SNAP_LATENTS_, _SNAP_SCOPE_OFFSETS_, _SNAP_SCOPES_, _SNAP_CPT_OFFSETS_, _SNAP_CPTS_,
+        _SNAP_ANCESTORS_, _SNAP_CCOMPONENTS_, _SNAP_NB_SECTIONS_
+    };
+
+    static_assert(_SNAP_NB_SECTIONS_ == 17, "CausalSnapshot::_nbSections_ must follow the sections");
+
+    static constexpr char _SNAP_magic_[8] = {'C', 'M', 'S', 'N', 'A', 'P', '\0', '\0'};
+    static constexpr uint32_t _SNAP_endian_ = 0x01020304;
+
+    /// internal : the header at the beginning of a snapshot, each section being aligned on 8 bytes
+    struct _SNAP_Header_ {
+        char magic[8];
+        uint32_t version;
+        uint32_t endian;
+        uint32_t idSize;
+        uint32_t flags;     ///< 1 : ancestors, 2 : c-components
+        uint64_t bound;
+        uint64_t nodes;
+        uint64_t arcs;
+        uint64_t latents;
+        uint64_t words;     ///< 64-bit words per ancestor row
+        uint64_t offsets[_SNAP_NB_SECTIONS_];
+        uint64_t sizes[_SNAP_NB_SECTIONS_];  ///< in bytes
+    };
+
+    /// internal : the ancestor bitsets of every node, rows of ``words`` words indexed by node id
+    static std::vector<uint64_t> _SNAP_ancestors_(const _SnapshotContent_& c, Size words){
+        const auto bound = c.bound;
+        auto rows = std::vector<uint64_t>(bound * words, 0);
+        // Kahn's order : the row of every parent is complete before its children are visited
+        auto indeg = std::vector<Size>(bound, 0);
+        auto queue = std::vector<NodeId>();
+        for(NodeId n = 0; n < bound; n++){
+            indeg[n] = c.parentOffsets[n + 1] - c.parentOffsets[n];
+            if(c.exists[n] && indeg[n] == 0) queue.push_back(n);
+        }
+        for(Size i = 0; i < queue.size(); i++){
+            const auto n = queue[i];
+            const auto row = rows.data() + n * words;
+            for(auto k = c.childOffsets[n]; k < c.childOffsets[n + 1]; k++){
+                const auto ch = c.children[k];
+                auto chrow = rows.data() + ch * words;
+                for(Size w = 0; w < words; w++) chrow[w] |= row[w];
+                chrow[n / 64] |= uint64_t(1) << (n % 64);
+                if(--indeg[ch] == 0) queue.push_back(ch);
+            }
+        }
+        return rows;
+    }
+
+    /// internal : the c-component of every observed node (the bound for the latent ones and the missing ids)
+    static std::vector<uint64_t> _SNAP_ccomponents_(const _SnapshotContent_& c){
+        const auto bound = c.bound;
+        auto parent = std::vector<NodeId>(bound);
+        for(NodeId n = 0; n < bound; n++) parent[n] = n;
+        const auto find = [&](NodeId n){
+            while(parent[n] != n) n = parent[n] = parent[parent[n]];
+            return n;
+        };
+        for(const auto& l : c.latents){
+            const auto first = c.childOffsets[l];
+            for(auto k = first + 1; k < c.childOffsets[l + 1]; k++){
+                const auto a = find(c.children[first]);
+                const auto b = find(c.children[k]);
+                if(a != b) parent[a] = b;
+            }
+        }
+        auto latent = std::vector<char>(bound, 0);
+        for(const auto& l : c.latents) latent[l] = 1;
+        auto res = std::vector<uint64_t>(bound, bound);
+        auto number = std::vector<uint64_t>(bound, bound);
+        uint64_t next = 0;
+        for(NodeId n = 0; n < bound; n++){
+            if(!c.exists[n] || latent[n]) continue;
+            const auto r = find(n);
+            if(number[r] == bound) number[r] = next++;
+            res[n] = number[r];
+        }
+        return res;
+    }
+
+    void _SNAP_write_(const _SnapshotContent_& c, const std::string& path, bool withIndices){
+        auto h = _SNAP_Header_();
+        std::memset(&h, 0, sizeof(h));
+        std::memcpy(h.magic, _SNAP_magic_, sizeof(h.magic));
+        h.version = CausalSnapshot::version;
+        h.endian = _SNAP_endian_;
+        h.idSize = sizeof(NodeId);
+        h.bound = c.bound;
+        for(const auto& e : c.exists) h.nodes += e;
+        h.arcs = c.children.size();
+        h.latents = c.latents.size();
+
+        auto ancestors = std::vector<uint64_t>();
+        auto ccomps = std::vector<uint64_t>();
+        if(withIndices){
+            h.flags = 3;
+            h.words = (c.bound + 63) / 64;
+            ancestors = _SNAP_ancestors_(c, h.words);
+            ccomps = _SNAP_ccomponents_(c);
+        }
+
+        const std::pair<const void*, Size> sections[_SNAP_NB_SECTIONS_] = {
+            {c.exists.data(), c.exists.size()},
+            {c.childOffsets.data(), c.childOffsets.size() * sizeof(uint64_t)},
+            {c.children.data(), c.children.size() * sizeof(NodeId)},
+            {c.parentOffsets.data(), c.parentOffsets.size() * sizeof(uint64_t)},
+            {c.parents.data(), c.parents.size() * sizeof(NodeId)},
+            {c.nameOffsets.data(), c.nameOffsets.size() * sizeof(uint64_t)},
+            {c.names.data(), c.names.size()},
+            {c.labelStarts.data(), c.labelStarts.size() * sizeof(uint64_t)},
+            {c.labelOffsets.data(), c.labelOffsets.size() * sizeof(uint64_t)},
+            {c.labels.data(), c.labels.size()},
+            {c.latents.data(), c.latents.size() * sizeof(NodeId)},
+            {c.scopeOffsets.data(), c.scopeOffsets.size() * sizeof(uint64_t)},
+            {c.scopes.data(), c.scopes.size() * sizeof(NodeId)},
+            {c.cptOffsets.data(), c.cptOffsets.size() * sizeof(uint64_t)},
+            {c.cpts.data(), c.cpts.size() * sizeof(double)},
+            {ancestors.data(), ancestors.size() * sizeof(uint64_t)},
+            {ccomps.data(), ccomps.size() * sizeof(uint64_t)}
+        };
+        uint64_t offset = (sizeof(h) + 7) / 8 * 8;
+        for(int s = 0; s < _SNAP_NB_SECTIONS_; s++){
+            h.offsets[s] = offset;
+            h.sizes[s] = sections[s].second;
+            offset += (sections[s].second + 7) / 8 * 8;
+        }
+
+        auto out = std::ofstream(path, std::ios::binary | std::ios::trunc);
+        if(!out) GUM_ERROR(IOError, "cannot write " << path)
+        static const char padding[8] = {0};
+        out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+        out.write(padding, h.offsets[0] - sizeof(h));
+        for(int s = 0; s < _SNAP_NB_SECTIONS_; s++){
+            out.write(static_cast<const char*>(sections[s].first), sections[s].second);
+            out.write(padding, (8 - sections[s].second % 8) % 8);
+        }
+        if(!out) GUM_ERROR(IOError, "cannot write " << path)
+    }
+
+    CausalSnapshot::CausalSnapshot(const std::string& path)
+        : _data_(nullptr), _length_(0),
+#ifdef _WIN32
+          _file_(INVALID_HANDLE_VALUE), _mapping_(nullptr),
+#else
+          _fd_(-1),
+#endif
+          _sections_(), _sizes_(), _bound_(0), _nodes_(0), _arcs_(0), _latents_(0), _words_(0), _ccomps_(false)
+    {
+#ifdef _WIN32
+        _file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        LARGE_INTEGER length;
+        if(_file_ == INVALID_HANDLE_VALUE || !GetFileSizeEx(_file_, &length)){
+            _close_();
+            GUM_ERROR(IOError, "cannot open " << path)
+        }
+        _length_ = static_cast<Size>(length.QuadPart);
+        _mapping_ = _length_ ? CreateFileMappingA(_file_, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+        _data_ = _mapping_ ? static_cast<const char*>(MapViewOfFile(_mapping_, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+#else
+        _fd_ = ::open(path.c_str(), O_RDONLY);
+        struct stat st;
+        if(_fd_ < 0 || ::fstat(_fd_, &st) != 0){
+            _close_();
+            GUM_ERROR(IOError, "cannot open " << path)
+        }
+        _length_ = static_cast<Size>(st.st_size);
+        if(_length_ > 0){
+            const auto p = ::mmap(nullptr, _length_, PROT_READ, MAP_SHARED, _fd_, 0);
+            _data_ = p == MAP_FAILED ? nullptr : static_cast<const char*>(p);
+        }
+#endif
+        if(_data_ == nullptr || _length_ < sizeof(_SNAP_Header_)){
+            _close_();
+            GUM_ERROR(IOError, path << " is not a causal snapshot")
+        }
+
+        _SNAP_Header_ h;
+        std::memcpy(&h, _data_, sizeof(h));
+        const char* problem = nullptr;
+        if(std::memcmp(h.magic, _SNAP_magic_, sizeof(h.magic)) != 0) problem = "not a causal snapshot";
+        else if(h.version != version) problem = "unsupported snapshot version";
+        else if(h.endian != _SNAP_endian_ || h.idSize != sizeof(NodeId)) problem = "snapshot written by an incompatible machine";
+        else
+            for(int s = 0; s < _SNAP_NB_SECTIONS_; s++)
+                if(h.offsets[s] % 8 != 0 || h.offsets[s] > _length_ || h.sizes[s] > _length_ - h.offsets[s]) problem = "truncated snapshot";
+        if(problem == nullptr){
+            const auto bound = h.bound;
+            const auto has = [&](int s, uint64_t bytes){ return h.sizes[s] == bytes; };
+            // the exists section bounds ``bound`` by the length of the file, so the products below cannot overflow
+            if(!has(_SNAP_EXISTS_, bound) || ((h.flags & 1) && h.words != (bound + 63) / 64) || !has(_SNAP_CHILD_OFFSETS_, (bound + 1) * 8) || !has(_SNAP_PARENT_OFFSETS_, (bound + 1) * 8) ||
+               !has(_SNAP_NAME_OFFSETS_, (bound + 1) * 8) || !has(_SNAP_LABEL_STARTS_, (bound + 1) * 8) ||
+               !has(_SNAP_SCOPE_OFFSETS_, (bound + 1) * 8) || !has(_SNAP_CPT_OFFSETS_, (bound + 1) * 8) ||
+               !has(_SNAP_CHILDREN_, h.arcs * sizeof(NodeId)) || !has(_SNAP_PARENTS_, h.arcs * sizeof(NodeId)) ||
+               !has(_SNAP_LATENTS_, h.latents * sizeof(NodeId)) ||
+               ((h.flags & 1) && !has(_SNAP_ANCESTORS_, bound * h.words * 8)) || ((h.flags & 2) && !has(_SNAP_CCOMPONENTS_, bound * 8)))
+                problem = "inconsistent snapshot";
+        }
+        if(problem != nullptr){
+            _close_();
+            GUM_ERROR(IOError, path << " : " << problem)
+        }
+
+        for(int s = 0; s < _SNAP_NB_SECTIONS_; s++){
+            _sections_[s] = _data_ + h.offsets[s];
+            _sizes_[s] = h.sizes[s];
+        }
+        _bound_ = h.bound;
+        _nodes_ = h.nodes;
+        _arcs_ = h.arcs;
+        _latents_ = h.latents;
+        _words_ = (h.flags & 1) ? h.words : 0;
+        _ccomps_ = (h.flags & 2) != 0;
+        GUM_CONSTRUCTOR(CausalSnapshot)
+    }
+
+    CausalSnapshot::CausalSnapshot(CausalSnapshot&& other)
+        : _data_(std::exchange(other._data_, nullptr)), _length_(std::exchange(other._length_, 0)),
+#ifdef _WIN32
+          _file_(std::exchange(other._file_, INVALID_HANDLE_VALUE)), _mapping_(std::exchange(other._mapping_, nullptr)),
+#else
+          _fd_(std::exchange(other._fd_, -1)),
+#endif
+          _sections_(), _sizes_(), _bound_(other._bound_), _nodes_(other._nodes_), _arcs_(other._arcs_), _latents_(other._latents_),
+          _words_(other._words_), _ccomps_(other._ccomps_)
+    {
+        std::memcpy(_sections_, other._sections_, sizeof(_sections_));
+        std::memcpy(_sizes_, other._sizes_, sizeof(_sizes_));
+        GUM_CONS_MOV(CausalSnapshot)
+    }
+
+    CausalSnapshot::~CausalSnapshot(){
+        _close_();
+        GUM_DESTRUCTOR(CausalSnapshot)
+    }
+
+    void CausalSnapshot::_close_(){
+#ifdef _WIN32
+        if(_data_ != nullptr) UnmapViewOfFile(_data_);
+        if(_mapping_ != nullptr) CloseHandle(_mapping_);
+        if(_file_ != INVALID_HANDLE_VALUE) CloseHandle(_file_);
+        _mapping_ = nullptr;
+        _file_ = INVALID_HANDLE_VALUE;
+#else
+        if(_data_ != nullptr) ::munmap(const_cast<char*>(_data_), _length_);
+        if(_fd_ >= 0) ::close(_fd_);
+        _fd_ = -1;
+#endif
+        _data_ = nullptr;
+    }
+
+    template<typename T>
+    const T* CausalSnapshot::_section_(int s) const {
+        return static_cast<const T*>(_sections_[s]);
+    }
+
+    void CausalSnapshot::_check_(NodeId n) const {
+        if(n >= _bound_) GUM_ERROR(NotFound, "no node " << n << " in the snapshot")
+    }
+
+    std::pair<uint64_t, uint64_t> CausalSnapshot::_entries_(int s, NodeId n, int target, Size elem) const {
+        _check_(n);
+        const auto off = _section_<uint64_t>(s);
+        if(off[n] > off[n + 1] || off[n + 1] > _sizes_[target] / elem)
+            GUM_ERROR(IOError, "corrupted snapshot : the entries of the node " << n << " are out of their section")
+        return {off[n], off[n + 1]};
+    }
+
+    Size CausalSnapshot::bound() const {
+        return _bound_;
+    }
+
+    Size CausalSnapshot::size() const {
+        return _nodes_;
+    }
+
+    Size CausalSnapshot::sizeArcs() const {
+        return _arcs_;
+    }
+
+    bool CausalSnapshot::exists(NodeId n) const {
+        return n < _bound_ && _section_<uint8_t>(_SNAP_EXISTS_)[n];
+    }
+
+    NodeRange CausalSnapshot::children(NodeId n) const {
+        const auto [first, last] = _entries_(_SNAP_CHILD_OFFSETS_, n, _SNAP_CHILDREN_, sizeof(NodeId));
+        const auto ch = _section_<NodeId>(_SNAP_CHILDREN_);
+        return NodeRange{ch + first, ch + last};
+    }
+
+    NodeRange CausalSnapshot::parents(NodeId n) const {
+        const auto [first, last] = _entries_(_SNAP_PARENT_OFFSETS_, n, _SNAP_PARENTS_, sizeof(NodeId));
+        const auto pa = _section_<NodeId>(_SNAP_PARENTS_);
+        return NodeRange{pa + first, pa + last};
+    }
+
+    std::string_view CausalSnapshot::name(NodeId n) const {
+        const auto [first, last] = _entries_(_SNAP_NAME_OFFSETS_, n, _SNAP_NAMES_, 1);
+        return std::string_view(_section_<char>(_SNAP_NAMES_) + first, last - first);
+    }
+
+    Size CausalSnapshot::domainSize(NodeId n) const {
+        // the label offsets have one more entry than the labels
+        const auto [first, last] = _entries_(_SNAP_LABEL_STARTS_, n, _SNAP_LABEL_OFFSETS_, sizeof(uint64_t));
+        if(last == _sizes_[_SNAP_LABEL_OFFSETS_] / sizeof(uint64_t))
+            GUM_ERROR(IOError, "corrupted snapshot : the labels of the node " << n << " are out of their section")
+        return last - first;
+    }
+
+    std::string_view CausalSnapshot::label(NodeId n, Idx k) const {
+        if(k >= domainSize(n)) GUM_ERROR(OutOfBounds, "no state " << k << " for the variable " << name(n))
+        const auto off = _section_<uint64_t>(_SNAP_LABEL_OFFSETS_) + _section_<uint64_t>(_SNAP_LABEL_STARTS_)[n] + k;
+        if(off[0] > off[1] || off[1] > _sizes_[_SNAP_LABELS_])
+            GUM_ERROR(IOError, "corrupted snapshot : the labels of the node " << n << " are out of their section")
+        return std::string_view(_section_<char>(_SNAP_LABELS_) + off[0], off[1] - off[0]);
+    }
+
+    NodeRange CausalSnapshot::latents() const {
+        const auto l = _section_<NodeId>(_SNAP_LATENTS_);
+        return NodeRange{l, l + _latents_};
+    }
+
+    CausalSnapshot::Table CausalSnapshot::cpt(NodeId n) const {
+        const auto [sfirst, slast] = _entries_(_SNAP_SCOPE_OFFSETS_, n, _SNAP_SCOPES_, sizeof(NodeId));
+        const auto [cfirst, clast] = _entries_(_SNAP_CPT_OFFSETS_, n, _SNAP_CPTS_, sizeof(double));
+        const auto scopes = _section_<NodeId>(_SNAP_SCOPES_);
+        return Table{NodeRange{scopes + sfirst, scopes + slast}, _section_<double>(_SNAP_CPTS_) + cfirst, clast - cfirst};
+    }
+
+    bool CausalSnapshot::hasAncestors() const {
+        return _words_ > 0;
+    }
+
+    bool CausalSnapshot::isAncestor(NodeId a, NodeId n) const {
+        if(!hasAncestors()) GUM_ERROR(OperationNotAllowed, "the snapshot has no ancestor bitsets")
+        _check_(a);
+        _check_(n);
+        return (_section_<uint64_t>(_SNAP_ANCESTORS_)[n * _words_ + a / 64] >> (a % 64)) & 1;
+    }
+
+    NodeSet CausalSnapshot::ancestors(NodeId n) const {
+        if(!hasAncestors()) GUM_ERROR(OperationNotAllowed, "the snapshot has no ancestor bitsets")
+        _check_(n);
+        auto res = NodeSet();
+        const auto row = _section_<uint64_t>(_SNAP_ANCESTORS_) + n * _words_;
+        for(Size w = 0; w < _words_; w++)
+            for(auto bits = row[w]; bits != 0; bits &= bits - 1) res.insert(w * 64 + std::countr_zero(bits));
+        return res;
+    }
+
+    bool CausalSnapshot::hasCComponents() const {
+        return _ccomps_;
+    }
+
+    Size CausalSnapshot::cComponent(NodeId n) const {
+        if(!_ccomps_) GUM_ERROR(OperationNotAllowed, "the snapshot has no c-components")
+        _check_(n);
+        return _section_<uint64_t>(_SNAP_CCOMPONENTS_)[n];
+    }
+}
@@ -0,0 +1,219 @@
+#ifndef GUM_CAUSAL_SNAPSHOT_H
+#define GUM_CAUSAL_SNAPSHOT_H
+
+#include <agrum/BN/BayesNet.h>
+#include <agrum/tools/multidim/instantiation.h>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "CausalModel.h"
+#include "bnLoaders.h"
+#include "reachability.h"
+
+namespace gum{
+
+    /**
+     * @brief internal : the content of a snapshot before it is written, every
+     * section being a flat array indexed by node id (up to the bound of the ids)
+     */
+    struct _SnapshotContent_ {
+        Size bound = 0;
+        std::vector<uint8_t> exists;
+        std::vector<uint64_t> childOffsets, parentOffsets;
+        std::vector<NodeId> children, parents;
+        std::vector<uint64_t> nameOffsets;
+        std::string names;
+        std::vector<uint64_t> labelStarts, labelOffsets; ///< labels of node n : labelStarts[n]..labelStarts[n+1] in labelOffsets
+        std::string labels;
+        std::vector<NodeId> latents;
+        std::vector<uint64_t> scopeOffsets, cptOffsets;
+        std::vector<NodeId> scopes;   ///< variables of each CPT, in its order (the first varying the fastest)
+        std::vector<double> cpts;
+    };
+
+    /**
+     * @brief internal : writes ``content`` to ``path``, adding the ancestor
+     * bitsets and the c-components if asked
+     * @throw IOError if the file cannot be written
+     */
+    void _SNAP_write_(const _SnapshotContent_& content, const std::string& path, bool withIndices);
+
+    /**
+     * @brief Writes a binary snapshot of ``cm`` to ``path`` : the causal graph
+     * as compressed adjacency arrays, the names and labels of the variables,
+     * the CPTs of the observational network, the latent variables and,
+     * optionally, the ancestors of every node (as bitsets) and the
+     * c-components (the classes of the observed nodes sharing a latent
+     * parent, closed transitively).
+     *
+     * The file is meant to be read back by @ref CausalSnapshot ; it uses the
+     * byte order and the id size of the machine that writes it, both being
+     * checked on load.
+     *
+     * @tparam GUM_SCALAR
+     * @param cm the causal model
+     * @param path the file
+     * @param withIndices whether the ancestor bitsets and the c-components are
+     * stored (O(|V|²) bits for the ancestors, so not by default)
+     * @throw IOError if the file cannot be written
+     */
+    template<typename GUM_SCALAR>
+    void write_snapshot(const CausalModel<GUM_SCALAR>& cm, const std::string& path, bool withIndices = false);
+
+    /**
+     * @class CausalSnapshot
+     * @brief Read-only view of a snapshot written by @ref write_snapshot.
+     *
+     * The file is mapped in memory and never parsed: the header is checked
+     * (magic, version, byte order, id size, section bounds) and every
+     * accessor reads the mapped arrays in place, so opening costs the same
+     * whatever the size of the model and only the pages actually touched
+     * are read from the disk. The accessors check the offsets they read
+     * against the sizes of the sections, so a corrupted file raises an
+     * IOError instead of reading outside the mapping.
+     *
+     * The snapshot is a graph for the templates of @ref reachability.h
+     * (bound(), exists(), children(), parents()) ; @ref load_snapshot builds
+     * the network and the causal model back from it.
+     */
+    class CausalSnapshot {
+    public:
+        static constexpr uint32_t version = 1;
+
+        /// a CPT of the snapshot : its variables (the first varying the fastest) and its values
+        struct Table {
+            NodeRange scope;
+            const double* values;
+            Size size;
+        };
+
+    private:
+        const char* _data_;  ///< the mapped file
+        Size _length_;
+#ifdef _WIN32
+        void* _file_;
+        void* _mapping_;
+#else
+        int _fd_;
+#endif
+        static constexpr int _nbSections_ = 17;
+        const void* _sections_[_nbSections_]; ///< start of each section in the mapping
+        Size _sizes_[_nbSections_];           ///< size of each section, in bytes
+        Size _bound_;
+        Size _nodes_;
+        Size _arcs_;
+        Size _latents_;
+        Size _words_;     ///< 64-bit words per ancestor row, 0 if the ancestors are not stored
+        bool _ccomps_;
+
+        template<typename T>
+        const T* _section_(int s) const;
+
+        /**
+         * @brief internal : the entries ``[first, last)`` of the node ``n`` in the
+         * section ``target`` (of ``elem`` bytes each) given by the offsets section ``s``
+         * @throw NotFound if ``n`` is not below the bound
+         * @throw IOError if the offsets are outside ``target``
+         */
+        std::pair<uint64_t, uint64_t> _entries_(int s, NodeId n, int target, Size elem) const;
+
+        /// internal : checks that ``n`` is below the bound
+        void _check_(NodeId n) const;
+        void _close_();
+
+    public:
+        /**
+         * @brief Maps the snapshot ``path``
+         * @throw IOError if the file cannot be mapped or is not a valid snapshot of this version
+         */
+        explicit CausalSnapshot(const std::string& path);
+        CausalSnapshot(CausalSnapshot&& other);
+        CausalSnapshot(const CausalSnapshot&) = delete;
+        CausalSnapshot& operator=(const CausalSnapshot&) = delete;
+        ~CausalSnapshot();
+
+        /// upper bound of the node ids
+        Size bound() const;
+
+        /// number of nodes (latent ones included)
+        Size size() const;
+
+        /// number of arcs
+        Size sizeArcs() const;
+
+        /// whether ``n`` is a node of the model
+        bool exists(NodeId n) const;
+
+        /**
+         * @brief Returns the children of ``n``
+         * @throw NotFound if ``n`` is not below the bound
+         * @throw IOError if the snapshot is corrupted
+         */
+        NodeRange children(NodeId n) const;
+
+        /// parents of ``n`` (see @ref children)
+        NodeRange parents(NodeId n) const;
+
+        /// name of the variable ``n``
+        std::string_view name(NodeId n) const;
+
+        /// number of states of the variable ``n``
+        Size domainSize(NodeId n) const;
+
+        /// label of the state ``k`` of the variable ``n``
+        std::string_view label(NodeId n, Idx k) const;
+
+        /// the latent variables
+        NodeRange latents() const;
+
+        /// the CPT of ``n`` in the observational network (empty for a latent variable)
+        Table cpt(NodeId n) const;
+
+        /// whether the ancestor bitsets are stored
+        bool hasAncestors() const;
+
+        /**
+         * @brief Predicate on ``a`` being a strict ancestor of ``n``
+         * @throw OperationNotAllowed if the ancestors are not stored
+         */
+        bool isAncestor(NodeId a, NodeId n) const;
+
+        /**
+         * @brief Returns the strict ancestors of ``n``
+         * @throw OperationNotAllowed if the ancestors are not stored
+         */
+        NodeSet ancestors(NodeId n) const;
+
+        /// whether the c-components are stored
+        bool hasCComponents() const;
+
+        /**
+         * @brief Returns the c-component of the observed node ``n`` (the
+         * c-components being numbered from 0), the bound for a latent node
+         * @throw OperationNotAllowed if the c-components are not stored
+         */
+        Size cComponent(NodeId n) const;
+    };
+
+    /**
+     * @brief Builds the observational network and the causal model of a
+     * snapshot : the variables, their tables and the causal arcs (the ones
+     * entering a latent variable included) are the ones of the snapshot, the
+     * observed nodes keeping their ids (the latent ones are numbered by the
+     * causal model).
+     *
+     * @tparam GUM_SCALAR
+     * @param snap the snapshot
+     * @return LoadedCausalModel<GUM_SCALAR> the network and the model over it
+     * @throw IOError if the snapshot is corrupted
+     */
+    template<typename GUM_SCALAR>
+    LoadedCausalModel<GUM_SCALAR> load_snapshot(const CausalSnapshot& snap);
+}
+
+#include "causalSnapshot_tpl.h"
+
+#endif
@@ -0,0 +1,118 @@
+#include "causalSnapshot.h"
+
+#include <agrum/tools/variables/labelizedVariable.h>
+
+namespace gum{
+
+    template<typename GUM_SCALAR>
+    void write_snapshot(const CausalModel<GUM_SCALAR>& cm, const std::string& path, bool withIndices){
+        const auto& bn = cm.observationalBN();
+        auto c = _SnapshotContent_();
+        c.bound = cm.nodes().bound();
+        const auto bound = c.bound;
+        c.exists.assign(bound, 0);
+        c.childOffsets.assign(bound + 1, 0);
+        c.parentOffsets.assign(bound + 1, 0);
+        c.nameOffsets.assign(bound + 1, 0);
+        c.labelStarts.assign(bound + 1, 0);
+        c.scopeOffsets.assign(bound + 1, 0);
+        c.cptOffsets.assign(bound + 1, 0);
+        c.labelOffsets.push_back(0);
+        c.children.reserve(cm.sizeArcs());
+        c.parents.reserve(cm.sizeArcs());
+
+        auto inst = Instantiation();
+        for(NodeId n = 0; n < bound; n++){
+            if(cm.nodes().exists(n)){
+                c.exists[n] = 1;
+                for(const auto& x : cm.children(n)) c.children.push_back(x);
+                for(const auto& x : cm.parents(n)) c.parents.push_back(x);
+                const auto& var = cm.variable(n);
+                c.names += var.name();
+                for(Idx k = 0; k < var.domainSize(); k++){
+                    c.labels += var.label(k);
+                    c.labelOffsets.push_back(c.labels.size());
+                }
+                if(cm.latentVariablesIds().contains(n)) c.latents.push_back(n);
+                else {
+                    const auto& cpt = bn.cpt(bn.idFromName(var.name()));
+                    for(Idx k = 0; k < cpt.nbrDim(); k++) c.scopes.push_back(cm.idFromName(cpt.variable(k).name()));
+                    inst = Instantiation(cpt);
+                    for(inst.setFirst(); !inst.end(); inst.inc()) c.cpts.push_back(static_cast<double>(cpt.get(inst)));
+                }
+            }
+            c.childOffsets[n + 1] = c.children.size();
+            c.parentOffsets[n + 1] = c.parents.size();
+            c.nameOffsets[n + 1] = c.names.size();
+            c.labelStarts[n + 1] = c.labelOffsets.size() - 1;
+            c.scopeOffsets[n + 1] = c.scopes.size();
+            c.cptOffsets[n + 1] = c.cpts.size();
+        }
+        _SNAP_write_(c, path, withIndices);
+    }
+
+    template<typename GUM_SCALAR>
+    LoadedCausalModel<GUM_SCALAR> load_snapshot(const CausalSnapshot& snap){
+        auto res = LoadedCausalModel<GUM_SCALAR>();
+        // built in place : a BayesNet is not cheaply movable, its tables would be copied
+        res.bn = std::make_unique<BayesNet<GUM_SCALAR>>();
+        auto& bn = *res.bn;
+        auto latent = std::vector<char>(snap.bound(), 0);
+        for(const auto& l : snap.latents()){
+            if(!snap.exists(l)) GUM_ERROR(IOError, "the latent variable " << l << " of the snapshot is not a node")
+            latent[l] = 1;
+        }
+        auto observed = std::vector<NodeId>();
+        for(NodeId n = 0; n < snap.bound(); n++){
+            if(!snap.exists(n) || latent[n]) continue;
+            const auto name = std::string(snap.name(n));
+            auto var = LabelizedVariable(name, name, 0);
+            for(Idx k = 0; k < snap.domainSize(n); k++) var.addLabel(std::string(snap.label(n, k)));
+            bn.add(var, n);
+            observed.push_back(n);
+        }
+
+        // the arcs of the observational network are the scopes of the tables
+        bn.beginTopologyTransformation();
+        for(const auto& n : observed)
+            for(const auto& p : snap.cpt(n).scope)
+                if(p != n) bn.addArc(p, n);
+        bn.endTopologyTransformation();
+
+        auto inst = Instantiation();
+        for(const auto& n : observed){
+            const auto table = snap.cpt(n);
+            inst.clear();
+            for(const auto& v : table.scope) inst.add(bn.variable(v));
+            if(inst.domainSize() != table.size) GUM_ERROR(IOError, "wrong table size for " << snap.name(n) << " in the snapshot")
+            const auto& cpt = bn.cpt(n);
+            Size k = 0;
+            for(inst.setFirst(); !inst.end(); inst.inc()) cpt.set(inst, static_cast<GUM_SCALAR>(table.values[k++]));
+        }
+
+        auto latents = LatentDescriptors();
+        for(const auto& l : snap.latents()){
+            auto children = std::vector<NodeId>();
+            for(const auto& c : snap.children(l))
+                if(!latent[c]) children.push_back(c);
+            latents.emplace_back(std::string(snap.name(l)), std::move(children));
+        }
+        // the arcs kept or removed between the children of a latent variable are the ones of the snapshot
+        res.model = std::make_unique<CausalModel<GUM_SCALAR>>(bn, latents, true);
+        for(const auto& n : observed){
+            auto causal = NodeSet();
+            for(const auto& p : snap.parents(n))
+                if(!latent[p]) causal.insert(p);
+            for(const auto& p : bn.parents(n))
+                if(!causal.contains(p)) res.model->eraseCausalArc(p, n);
+            for(const auto& p : causal)
+                if(!bn.parents(n).contains(p)) res.model->addCausalArc(p, n);
+        }
+        // the arcs entering the latent variables, from an observed or a latent node : 
+        // the latent variables are numbered again by the model
+        const auto modelId = [&](NodeId n){ return latent[n] ? res.model->idFromName(std::string(snap.name(n))) : n; };
+        for(const auto& l : snap.latents())
+            for(const auto& p : snap.parents(l)) res.model->addCausalArc(modelId(p), modelId(l));
+        return res;
+    }
+}
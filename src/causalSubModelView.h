@@ -0,0 +1,174 @@
+#ifndef GUM_CAUSAL_SUB_MODEL_VIEW_H
+#define GUM_CAUSAL_SUB_MODEL_VIEW_H
+
+#include <agrum/tools/core/set.h>
+#include <agrum/tools/core/hashTable.h>
+#include <agrum/tools/graphs/graphElements.h>
+#include <string>
+#include <vector>
+
+#include "CausalModel.h"
+
+namespace gum{
+
+    /**
+     * @class CausalSubModelView
+     * @brief Read-only view of the causal model induced by a set of observed
+     * nodes of a @ref CausalModel : the arcs between the kept nodes, and the
+     * latent variables that still confound at least two of them (the others
+     * change no c-component and are dropped), with their arcs to the kept nodes.
+     *
+     * The view only stores the kept observed nodes over the storage of the
+     * model, so building one costs O(|nodes|) ; a view of a view is a view
+     * of the same model. The latent variables are computed on first use from
+     * the parents of the kept nodes, in O(arcs entering them), and the parents
+     * and children lists on first use too. The view implements the DAG-like
+     * interface expected by the ``GraphT`` algorithms and the part of the
+     * interface of @ref CausalModel used by the identification algorithm.
+     *
+     * @warning ``cm`` must outlive the view and must not change while the
+     * view is used ; the lists computed on first use make a view unsafe to
+     * share between threads.
+     */
+    template<typename GUM_SCALAR>
+    class CausalSubModelView {
+    public:
+        /**
+         * @brief The nodes of the view : a NodeSet knowing, as the nodes of a
+         * graph, the bound of the ids of the model, so that the ``GraphT``
+         * algorithms can size their arrays indexed by node id
+         */
+        class Nodes : public NodeSet {
+        private:
+            Size _bound_;
+        public:
+            Nodes();
+            Nodes(const NodeSet& nodes, Size bound);
+
+            /// upper bound of the node ids of the model
+            Size bound() const;
+
+            /// whether ``n`` is a node of the view
+            bool exists(NodeId n) const;
+
+            /// the nodes as a NodeSet
+            const NodeSet& asNodeSet() const;
+        };
+
+    private:
+        const CausalModel<GUM_SCALAR>* _cm_;
+        NodeSet _observed_;                             ///< the kept observed nodes
+        mutable bool _built_;                           ///< whether _latents_ and _nodes_ are computed
+        mutable NodeSet _latents_;                      ///< the kept latent nodes
+        mutable Nodes _nodes_;                          ///< the kept nodes, latent ones included
+        mutable HashTable<NodeId, NodeSet> _parents_;   ///< parents lists computed so far
+        mutable HashTable<NodeId, NodeSet> _children_;  ///< children lists computed so far
+
+        void _build_() const;
+
+    public:
+        /**
+         * @brief The view of the whole model
+         */
+        explicit CausalSubModelView(const CausalModel<GUM_SCALAR>& cm);
+
+        /**
+         * @brief The view of the sub-model induced by ``nodes``
+         *
+         * @param cm the causal model
+         * @param nodes the nodes kept, the latent ones being ignored
+         */
+        CausalSubModelView(const CausalModel<GUM_SCALAR>& cm, const NodeSet& nodes);
+        CausalSubModelView(const CausalSubModelView<GUM_SCALAR>& other);
+        CausalSubModelView(CausalSubModelView<GUM_SCALAR>&& other);
+        ~CausalSubModelView();
+        CausalSubModelView() = delete;
+
+        /**
+         * @brief Returns the view of the sub-model induced by the nodes of
+         * ``nodes`` kept by this view, over the same model
+         */
+        CausalSubModelView<GUM_SCALAR> induced(const NodeSet& nodes) const;
+
+        /// the underlying causal model
+        const CausalModel<GUM_SCALAR>& model() const;
+
+        /// the kept observed nodes
+        const NodeSet& observed() const;
+
+        /// the kept nodes, latent ones included
+        const Nodes& nodes() const;
+
+        /// the kept latent nodes
+        const NodeSet& latentVariablesIds() const;
+
+        /// number of nodes, latent ones included
+        Size size() const;
+
+        /// whether ``n`` is a node of the view
+        bool exists(NodeId n) const;
+
+        /// parents of ``n`` in the view
+        const NodeSet& parents(NodeId n) const;
+
+        /// children of ``n`` in the view
+        const NodeSet& children(NodeId n) const;
+
+        /// whether the arc ``tail -> head`` is in the view
+        bool existsArc(NodeId tail, NodeId head) const;
+
+        /// the arcs of the view (built on each call)
+        ArcSet arcs() const;
+
+        /// number of arcs of the view
+        Size sizeArcs() const;
+
+        /// ancestors of ``n`` in the view (``n`` excluded)
+        NodeSet ancestors(NodeId n) const;
+
+        /// descendants of ``n`` in the view (``n`` excluded)
+        NodeSet descendants(NodeId n) const;
+
+        /**
+         * @brief Returns the c-components of the kept observed nodes, derived 
+         * from the index of the model : a c-component of the model kept whole 
+         * is kept as is, only the ones losing nodes are split again.
+         */
+        std::vector<NodeSet> cComponents() const;
+
+        /// the canonical fingerprint of the view (see @ref CausalModel::fingerprint), computed in O(|view|)
+        uint64_t fingerprint() const;
+
+        /// the names of the variables of the model (the dropped ones included)
+        decltype(auto) names() const;
+
+        /**
+         * @param name
+         * @return NodeId
+         * @throw NotFound if no node of the view has this name
+         */
+        NodeId idFromName(const std::string& name) const;
+
+        /// the causal network of the model
+        const BayesNet<GUM_SCALAR>& causalBN() const;
+
+        /// the observational network of the model
+        const BayesNet<GUM_SCALAR>& observationalBN() const;
+    };
+
+    /**
+     * @brief Returns the view of the causal model induced by a subset of
+     * nodes : the cheap counterpart of @ref inducedCausalSubModel, the latent
+     * variables confounding less than two kept nodes being dropped.
+     *
+     * @param cm the causal model
+     * @param sns the set of nodes
+     * @return CausalSubModelView the view of the induced sub-causal model
+     */
+    template<typename GUM_SCALAR>
+    CausalSubModelView<GUM_SCALAR> inducedCausalSubModelView(const CausalModel<GUM_SCALAR>& cm, const NodeSet& sns);
+}
+
+#include "causalSubModelView_tpl.h"
+
+#endif
@@ -0,0 +1,262 @@
+#include "causalSubModelView.h"
+
+namespace gum{
+
+    template<typename GUM_SCALAR>
+    CausalSubModelView<GUM_SCALAR>::Nodes::Nodes()
+        : NodeSet(), _bound_(0)
+    {}
+
+    template<typename GUM_SCALAR>
+    CausalSubModelView<GUM_SCALAR>::Nodes::Nodes(const NodeSet& nodes, Size bound)
+        : NodeSet(nodes), _bound_(bound)
+    {}
+
+    template<typename GUM_SCALAR>
+    Size CausalSubModelView<GUM_SCALAR>::Nodes::bound() const {
+        return _bound_;
+    }
+
+    template<typename GUM_SCALAR>
+    bool CausalSubModelView<GUM_SCALAR>::Nodes::exists(NodeId n) const {
+        return this->contains(n);
+    }
+
+    template<typename GUM_SCALAR>
+    const NodeSet& CausalSubModelView<GUM_SCALAR>::Nodes::asNodeSet() const {
+        return *this;
+    }
+
+    template<typename GUM_SCALAR>
+    CausalSubModelView<GUM_SCALAR>::CausalSubModelView(const CausalModel<GUM_SCALAR>& cm)
+        : _cm_(&cm), _observed_(), _built_(false), _latents_(), _nodes_(), _parents_(), _children_()
+    {
+        for(const auto& n : cm.nodes())
+            if(!cm.latentVariablesIds().contains(n)) _observed_.insert(n);
+        GUM_CONSTRUCTOR(CausalSubModelView)
+    }
+
+    template<typename GUM_SCALAR>
+    CausalSubModelView<GUM_SCALAR>::CausalSubModelView(const CausalModel<GUM_SCALAR>& cm, const NodeSet& nodes)
+        : _cm_(&cm), _observed_(), _built_(false), _latents_(), _nodes_(), _parents_(), _children_()
+    {
+        for(const auto& n : nodes)
+            if(cm.nodes().exists(n) && !cm.latentVariablesIds().contains(n)) _observed_.insert(n);
+        GUM_CONSTRUCTOR(CausalSubModelView)
+    }
+
+    template<typename GUM_SCALAR>
+    CausalSubModelView<GUM_SCALAR>::CausalSubModelView(const CausalSubModelView<GUM_SCALAR>& other)
+        : _cm_(other._cm_), _observed_(other._observed_), _built_(other._built_), _latents_(other._latents_),
+          _nodes_(other._nodes_), _parents_(other._parents_), _children_(other._children_)
+    {
+        GUM_CONS_CPY(CausalSubModelView)
+    }
+
+    template<typename GUM_SCALAR>
+    CausalSubModelView<GUM_SCALAR>::CausalSubModelView(CausalSubModelView<GUM_SCALAR>&& other)
+        : _cm_(other._cm_), _observed_(std::move(other._observed_)), _built_(other._built_), _latents_(std::move(other._latents_)),
+          _nodes_(std::move(other._nodes_)), _parents_(std::move(other._parents_)), _children_(std::move(other._children_))
+    {
+        other._built_ = false;
+        GUM_CONS_MOV(CausalSubModelView)
+    }
+
+    template<typename GUM_SCALAR>
+    CausalSubModelView<GUM_SCALAR>::~CausalSubModelView(){
+        GUM_DESTRUCTOR(CausalSubModelView)
+    }
+
+    template<typename GUM_SCALAR>
+    void CausalSubModelView<GUM_SCALAR>::_build_() const {
+        if(_built_) return;
+        // a latent variable confounds two kept nodes if it is the parent of two of them
+        const auto& latents = _cm_->latentVariablesIds();
+        auto kept = HashTable<NodeId, Size>(); // number of kept children of the latent parents
+        for(const auto& n : _observed_)
+            for(const auto& p : _cm_->parents(n)){
+                if(!latents.contains(p)) continue;
+                if(!kept.exists(p)) kept.insert(p, 0);
+                if(++kept[p] == 2) _latents_.insert(p);
+            }
+        _nodes_ = Nodes(_observed_ + _latents_, _cm_->nodes().bound());
+        _built_ = true;
+    }
+
+    template<typename GUM_SCALAR>
+    CausalSubModelView<GUM_SCALAR> CausalSubModelView<GUM_SCALAR>::induced(const NodeSet& nodes) const {
+        auto res = CausalSubModelView<GUM_SCALAR>(*_cm_, NodeSet());
+        for(const auto& n : nodes)
+            if(_observed_.contains(n)) res._observed_.insert(n);
+        return res;
+    }
+
+    template<typename GUM_SCALAR>
+    const CausalModel<GUM_SCALAR>& CausalSubModelView<GUM_SCALAR>::model() const {
+        return *_cm_;
+    }
+
+    template<typename GUM_SCALAR>
+    const NodeSet& CausalSubModelView<GUM_SCALAR>::observed() const {
+        return _observed_;
+    }
+
+    template<typename GUM_SCALAR>
+    const typename CausalSubModelView<GUM_SCALAR>::Nodes& CausalSubModelView<GUM_SCALAR>::nodes() const {
+        _build_();
+        return _nodes_;
+    }
+
+    template<typename GUM_SCALAR>
+    const NodeSet& CausalSubModelView<GUM_SCALAR>::latentVariablesIds() const {
+        _build_();
+        return _latents_;
+    }
+
+    template<typename GUM_SCALAR>
+    Size CausalSubModelView<GUM_SCALAR>::size() const {
+        return nodes().size();
+    }
+
+    template<typename GUM_SCALAR>
+    bool CausalSubModelView<GUM_SCALAR>::exists(NodeId n) const {
+        return _observed_.contains(n) || latentVariablesIds().contains(n);
+    }
+
+    template<typename GUM_SCALAR>
+    const NodeSet& CausalSubModelView<GUM_SCALAR>::parents(NodeId n) const {
+        if(!_parents_.exists(n)){
+            auto res = NodeSet();
+            if(exists(n))
+                for(const auto& p : _cm_->parents(n))
+                    if(exists(p)) res.insert(p);
+            _parents_.insert(n, std::move(res));
+        }
+        return _parents_[n];
+    }
+
+    template<typename GUM_SCALAR>
+    const NodeSet& CausalSubModelView<GUM_SCALAR>::children(NodeId n) const {
+        if(!_children_.exists(n)){
+            auto res = NodeSet();
+            if(exists(n))
+                for(const auto& c : _cm_->children(n))
+                    if(exists(c)) res.insert(c);
+            _children_.insert(n, std::move(res));
+        }
+        return _children_[n];
+    }
+
+    template<typename GUM_SCALAR>
+    bool CausalSubModelView<GUM_SCALAR>::existsArc(NodeId tail, NodeId head) const {
+        return exists(tail) && exists(head) && _cm_->dag().existsArc(tail, head);
+    }
+
+    template<typename GUM_SCALAR>
+    ArcSet CausalSubModelView<GUM_SCALAR>::arcs() const {
+        auto res = ArcSet();
+        for(const auto& n : nodes())
+            for(const auto& c : children(n)) res.insert(Arc(n, c));
+        return res;
+    }
+
+    template<typename GUM_SCALAR>
+    Size CausalSubModelView<GUM_SCALAR>::sizeArcs() const {
+        Size res = 0;
+        for(const auto& n : nodes()) res += children(n).size();
+        return res;
+    }
+
+    template<typename GUM_SCALAR>
+    NodeSet CausalSubModelView<GUM_SCALAR>::ancestors(NodeId n) const {
+        auto res = NodeSet();
+        auto stack = std::vector<NodeId>({n});
+        while(!stack.empty()){
+            const auto x = stack.back();
+            stack.pop_back();
+            for(const auto& p : parents(x)){
+                if(res.contains(p)) continue;
+                res.insert(p);
+                stack.push_back(p);
+            }
+        }
+        return res;
+    }
+
+    template<typename GUM_SCALAR>
+    NodeSet CausalSubModelView<GUM_SCALAR>::descendants(NodeId n) const {
+        auto res = NodeSet();
+        auto stack = std::vector<NodeId>({n});
+        while(!stack.empty()){
+            const auto x = stack.back();
+            stack.pop_back();
+            for(const auto& c : children(x)){
+                if(res.contains(c)) continue;
+                res.insert(c);
+                stack.push_back(c);
+            }
+        }
+        return res;
+    }
+
+    template<typename GUM_SCALAR>
+    std::vector<NodeSet> CausalSubModelView<GUM_SCALAR>::cComponents() const {
+        const auto& index = _cm_->districts();
+        auto groups = HashTable<NodeId, NodeSet>(); // the kept nodes of each c-component of the model
+        for(const auto& n : _observed_){
+            const auto r = index.find(n);
+            if(!groups.exists(r)) groups.insert(r, NodeSet());
+            groups[r].insert(n);
+        }
+
+        auto res = std::vector<NodeSet>();
+        auto split = DistrictIndex();
+        for(const auto& g : groups){
+            // every latent linking the nodes of a whole c-component is kept (it has no other child)
+            if(g.second.size() == index.districtSize(g.first)) res.push_back(g.second);
+            else for(const auto& n : g.second) split.addNode(n);
+        }
+        if(split.sizeNodes() == 0) return res;
+
+        for(const auto& l : latentVariablesIds()){
+            const auto& ch = children(l);
+            const auto first = *ch.begin(); // a kept latent has two kept children
+            if(!split.contains(first)) continue;
+            for(const auto& c : ch) split.unite(first, c);
+        }
+        for(auto& d : split.districts()) res.push_back(std::move(d));
+        return res;
+    }
+
+    template<typename GUM_SCALAR>
+    uint64_t CausalSubModelView<GUM_SCALAR>::fingerprint() const {
+        return canonical_fingerprint(*this);
+    }
+
+    template<typename GUM_SCALAR>
+    decltype(auto) CausalSubModelView<GUM_SCALAR>::names() const {
+        return _cm_->names();
+    }
+
+    template<typename GUM_SCALAR>
+    NodeId CausalSubModelView<GUM_SCALAR>::idFromName(const std::string& name) const {
+        const auto id = _cm_->idFromName(name);
+        if(!exists(id)) GUM_ERROR(NotFound, "no variable named " << name << " in the sub-model")
+        return id;
+    }
+
+    template<typename GUM_SCALAR>
+    const BayesNet<GUM_SCALAR>& CausalSubModelView<GUM_SCALAR>::causalBN() const {
+        return _cm_->causalBN();
+    }
+
+    template<typename GUM_SCALAR>
+    const BayesNet<GUM_SCALAR>& CausalSubModelView<GUM_SCALAR>::observationalBN() const {
+        return _cm_->observationalBN();
+    }
+
+    template<typename GUM_SCALAR>
+    CausalSubModelView<GUM_SCALAR> inducedCausalSubModelView(const CausalModel<GUM_SCALAR>& cm, const NodeSet& sns){
+        return CausalSubModelView<GUM_SCALAR>(cm, sns);
+    }
+}
@@ -0,0 +1,127 @@
+#include "districtIndex.h"
+
+#include <utility>
+
+namespace gum{
+
+    DistrictIndex::DistrictIndex()
+        : _parent_(), _size_(), _nodes_(0), _count_(0)
+    {
+        GUM_CONSTRUCTOR(DistrictIndex)
+    }
+
+    DistrictIndex::DistrictIndex(const DistrictIndex& other)
+        : _parent_(other._parent_), _size_(other._size_), _nodes_(other._nodes_), _count_(other._count_)
+    {
+        GUM_CONS_CPY(DistrictIndex)
+    }
+
+    DistrictIndex::DistrictIndex(DistrictIndex&& other)
+        : _parent_(std::move(other._parent_)), _size_(std::move(other._size_)),
+          _nodes_(std::exchange(other._nodes_, 0)), _count_(std::exchange(other._count_, 0))
+    {
+        GUM_CONS_MOV(DistrictIndex)
+    }
+
+    DistrictIndex::~DistrictIndex(){
+        GUM_DESTRUCTOR(DistrictIndex)
+    }
+
+    DistrictIndex& DistrictIndex::operator=(const DistrictIndex& other){
+        _parent_ = other._parent_;
+        _size_ = other._size_;
+        _nodes_ = other._nodes_;
+        _count_ = other._count_;
+        GUM_OP_CPY(DistrictIndex)
+        return *this;
+    }
+
+    DistrictIndex& DistrictIndex::operator=(DistrictIndex&& other){
+        _parent_ = std::move(other._parent_);
+        _size_ = std::move(other._size_);
+        _nodes_ = std::exchange(other._nodes_, 0);
+        _count_ = std::exchange(other._count_, 0);
+        GUM_OP_MOV(DistrictIndex)
+        return *this;
+    }
+
+    void DistrictIndex::addNode(NodeId n){
+        if(contains(n)) return;
+        if(n >= _parent_.size()){
+            _parent_.resize(n + 1, _none_);
+            _size_.resize(n + 1, 0);
+        }
+        _parent_[n] = n;
+        _size_[n] = 1;
+        _nodes_++;
+        _count_++;
+    }
+
+    bool DistrictIndex::contains(NodeId n) const {
+        return n < _parent_.size() && _parent_[n] != _none_;
+    }
+
+    NodeId DistrictIndex::_root_(NodeId n){
+        while(_parent_[n] != n){
+            _parent_[n] = _parent_[_parent_[n]];
+            n = _parent_[n];
+        }
+        return n;
+    }
+
+    void DistrictIndex::unite(NodeId a, NodeId b){
+        if(!contains(a) || !contains(b)) GUM_ERROR(NotFound, "no node " << (contains(a) ? b : a) << " in the district index")
+        auto ra = _root_(a);
+        auto rb = _root_(b);
+        if(ra == rb) return;
+        if(_size_[ra] < _size_[rb]) std::swap(ra, rb);
+        _parent_[rb] = ra;
+        _size_[ra] += _size_[rb];
+        _count_--;
+    }
+
+    void DistrictIndex::clear(){
+        _parent_.clear();
+        _size_.clear();
+        _nodes_ = 0;
+        _count_ = 0;
+    }
+
+    NodeId DistrictIndex::find(NodeId n) const {
+        if(!contains(n)) GUM_ERROR(NotFound, "no node " << n << " in the district index")
+        while(_parent_[n] != n) n = _parent_[n];
+        return n;
+    }
+
+    bool DistrictIndex::sameDistrict(NodeId a, NodeId b) const {
+        return find(a) == find(b);
+    }
+
+    Size DistrictIndex::districtSize(NodeId n) const {
+        return _size_[find(n)];
+    }
+
+    Size DistrictIndex::sizeNodes() const {
+        return _nodes_;
+    }
+
+    Size DistrictIndex::size() const {
+        return _count_;
+    }
+
+    std::vector<NodeSet> DistrictIndex::districts() const {
+        auto res = std::vector<NodeSet>();
+        res.reserve(_count_);
+        auto slot = std::vector<Size>(_parent_.size(), _none_); // position of each root in res
+        for(NodeId n = 0; n < _parent_.size(); n++){
+            if(_parent_[n] == _none_) continue;
+            const auto r = find(n);
+            if(slot[r] == _none_){
+                slot[r] = res.size();
+                res.emplace_back();
+            }
+            res[slot[r]].insert(n);
+        }
+        return res;
+    }
+}
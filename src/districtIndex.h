@@ -0,0 +1,85 @@
+#ifndef GUM_DISTRICT_INDEX_H
+#define GUM_DISTRICT_INDEX_H
+
+#include <agrum/tools/core/set.h>
+#include <agrum/tools/graphs/graphElements.h>
+#include <vector>
+#include <limits>
+
+namespace gum{
+
+    /**
+     * @class DistrictIndex
+     * @brief Partition of the observed nodes of a causal model into districts
+     * (c-components : the classes of the nodes linked by chains of shared
+     * latent parents), kept as a union-find forest indexed by node id.
+     *
+     * A latent variable with ``k`` children costs ``k - 1`` unions instead of
+     * the ``k(k-1)/2`` edges of an explicit graph. The unions are by size, so
+     * the trees stay of logarithmic depth and the queries (which never
+     * compress the paths) do not write : a const index can be shared between
+     * threads. Since a union cannot be undone, removing a link requires
+     * a rebuild (see @ref clear).
+     */
+    class DistrictIndex {
+    private:
+        static constexpr NodeId _none_ = std::numeric_limits<NodeId>::max();
+
+        std::vector<NodeId> _parent_; ///< parent of each node in the forest, _none_ if not a node
+        std::vector<Size> _size_;     ///< size of the district of each root
+        Size _nodes_;
+        Size _count_;                 ///< number of districts
+
+        /// the root of ``n``, halving the path on the way
+        NodeId _root_(NodeId n);
+
+    public:
+        DistrictIndex();
+        DistrictIndex(const DistrictIndex& other);
+        DistrictIndex(DistrictIndex&& other);
+        ~DistrictIndex();
+        DistrictIndex& operator=(const DistrictIndex& other);
+        DistrictIndex& operator=(DistrictIndex&& other);
+
+        /// adds ``n`` as a district of its own (nothing if ``n`` is already there)
+        void addNode(NodeId n);
+
+        /// whether ``n`` is in the index
+        bool contains(NodeId n) const;
+
+        /**
+         * @brief Merges the districts of ``a`` and ``b``
+         * @throw NotFound if ``a`` or ``b`` is not in the index
+         */
+        void unite(NodeId a, NodeId b);
+
+        /// removes every node and every link
+        void clear();
+
+        /**
+         * @brief Returns the representative of the district of ``n``
+         * @throw NotFound if ``n`` is not in the index
+         */
+        NodeId find(NodeId n) const;
+
+        /// whether ``a`` and ``b`` are in the same district
+        bool sameDistrict(NodeId a, NodeId b) const;
+
+        /**
+         * @brief Returns the number of nodes of the district of ``n``
+         * @throw NotFound if ``n`` is not in the index
+         */
+        Size districtSize(NodeId n) const;
+
+        /// number of nodes in the index
+        Size sizeNodes() const;
+
+        /// number of districts
+        Size size() const;
+
+        /// the districts, by increasing smallest node id
+        std::vector<NodeSet> districts() const;
+    };
+}
+
+#endif
@@ -10,6 +10,7 @@
 #include <agrum/tools/core/hashTable.h>
 #include <agrum/tools/multidim/potential.h>
 #include <agrum/BN/BayesNet.h>
+#include <agrum/BN/IBayesNet.h>
 
 
 namespace gum{
@@ -93,9 +94,10 @@ namespace gum{
          * @brief Evaluation of an AST tree from inside a BN
          * 
          * @param bn the observational Bayesian network in which will be done the computations
+         * (any IBayesNet, e.g. the one of a @ref CausalModelVariant)
          * @return const Potential<GUM_SCALAR>&  the resulting Potential
          */
-        virtual Potential<GUM_SCALAR> eval(const BayesNet<GUM_SCALAR>& bn) const = 0;
+        virtual Potential<GUM_SCALAR> eval(const IBayesNet<GUM_SCALAR>& bn) const = 0;
 
         virtual void _print_(std::ostream& outs, int indent) const = 0;
 
@@ -254,7 +256,7 @@ namespace gum{
          * @param bn the observational Bayesian network in which will be done the computations
          * @return const Potential<GUM_SCALAR>&  the resulting Potential
          */
-        virtual Potential<GUM_SCALAR> eval(const BayesNet<GUM_SCALAR>& bn) const override;
+        virtual Potential<GUM_SCALAR> eval(const IBayesNet<GUM_SCALAR>& bn) const override;
 
         ___ASTtree_clone_function_injector_MACRO___
 
@@ -292,7 +294,7 @@ namespace gum{
          * @param bn the observational Bayesian network in which will be done the computations
          * @return const Potential<GUM_SCALAR>&  the resulting Potential
          */
-        virtual Potential<GUM_SCALAR> eval(const BayesNet<GUM_SCALAR>& bn) const override;
+        virtual Potential<GUM_SCALAR> eval(const IBayesNet<GUM_SCALAR>& bn) const override;
 
         ___ASTtree_clone_function_injector_MACRO___
 
@@ -331,7 +333,7 @@ namespace gum{
          * @param bn the observational Bayesian network in which will be done the computations
          * @return const Potential<GUM_SCALAR>&  the resulting Potential
          */
-        virtual Potential<GUM_SCALAR> eval(const BayesNet<GUM_SCALAR>& bn) const override;
+        virtual Potential<GUM_SCALAR> eval(const IBayesNet<GUM_SCALAR>& bn) const override;
 
         ___ASTtree_clone_function_injector_MACRO___
 
@@ -368,7 +370,7 @@ namespace gum{
          * @param bn the observational Bayesian network in which will be done the computations
          * @return const Potential<GUM_SCALAR>&  the resulting Potential
          */
-        virtual Potential<GUM_SCALAR> eval(const BayesNet<GUM_SCALAR>& bn) const override;
+        virtual Potential<GUM_SCALAR> eval(const IBayesNet<GUM_SCALAR>& bn) const override;
 
         ___ASTtree_clone_function_injector_MACRO___
 
@@ -399,6 +401,16 @@ namespace gum{
          * @param knwset a set of variable names (in the BN) conditioning in the posterior
          */
         ASTPosteriorProba(const std::shared_ptr<BayesNet<GUM_SCALAR>> bn, const std::shared_ptr<NameSet> varset, const std::shared_ptr<NameSet> knwset);
+
+        /**
+         * @brief Represents the probability ``other`` over renamed variables : the conditioning
+         * set is taken as it is, not reduced again in the BN of ``other`` (see @ref renamedTree)
+         * 
+         * @param other the probability renamed
+         * @param varset the names of its conditioned variables
+         * @param knwset the names of its conditioning variables
+         */
+        ASTPosteriorProba(const ASTPosteriorProba<GUM_SCALAR>& other, const std::shared_ptr<NameSet> varset, const std::shared_ptr<NameSet> knwset);
         ASTPosteriorProba() = delete;
         ASTPosteriorProba(const ASTPosteriorProba<GUM_SCALAR>& other);
         ~ASTPosteriorProba();
@@ -433,7 +445,7 @@ namespace gum{
          * @param bn the observational Bayesian network in which will be done the computations
          * @return const Potential<GUM_SCALAR>&  the resulting Potential
          */
-        virtual Potential<GUM_SCALAR> eval(const BayesNet<GUM_SCALAR>& bn) const override;
+        virtual Potential<GUM_SCALAR> eval(const IBayesNet<GUM_SCALAR>& bn) const override;
 
         ___ASTtree_clone_function_injector_MACRO___
 
@@ -480,7 +492,7 @@ namespace gum{
          * @param bn the observational Bayesian network in which will be done the computations
          * @return const Potential<GUM_SCALAR>&  the resulting Potential
          */
-        virtual Potential<GUM_SCALAR> eval(const BayesNet<GUM_SCALAR>& bn) const override;
+        virtual Potential<GUM_SCALAR> eval(const IBayesNet<GUM_SCALAR>& bn) const override;
 
         ___ASTtree_clone_function_injector_MACRO___
 
@@ -565,7 +577,7 @@ namespace gum{
          * @param bn the observational Bayesian network in which will be done the computations
          * @return const Potential<GUM_SCALAR>&  the resulting Potential
          */
-        virtual Potential<GUM_SCALAR> eval(const BayesNet<GUM_SCALAR>& bn) const override;
+        virtual Potential<GUM_SCALAR> eval(const IBayesNet<GUM_SCALAR>& bn) const override;
 
         ___ASTtree_clone_function_injector_MACRO___
 
@@ -636,6 +648,29 @@ namespace gum{
      */
     template<typename GUM_SCALAR>
     INLINE std::unique_ptr<ASTtree<GUM_SCALAR>> productOfTrees(Set<std::unique_ptr<ASTtree<GUM_SCALAR>>>& xs);
+
+    /**
+     * @brief create a copy of an ASTtree whose variables are renamed (e.g. the formula of a
+     * query re-indexed on other nodes of an isomorphic model)
+     * 
+     * @tparam GUM_SCALAR 
+     * @tparam Rename callable returning the new name of a variable name
+     * @param tree the tree to copy
+     * @param rename the renaming of the variables
+     * @return std::unique_ptr<ASTtree<GUM_SCALAR>> the renamed tree
+     */
+    template<typename GUM_SCALAR, typename Rename>
+    std::unique_ptr<ASTtree<GUM_SCALAR>> renamedTree(const ASTtree<GUM_SCALAR>& tree, const Rename& rename);
+
+    /**
+     * @brief the names of the variables of an ASTtree
+     * 
+     * @tparam GUM_SCALAR 
+     * @param tree the tree
+     * @return NameSet the variables of its probabilities and of its sums
+     */
+    template<typename GUM_SCALAR>
+    NameSet variablesOf(const ASTtree<GUM_SCALAR>& tree);
 }
 
 /**
@@ -139,7 +139,7 @@ namespace gum{
     }
 
     template<typename GUM_SCALAR>
-    Potential<GUM_SCALAR> ASTplus<GUM_SCALAR>::eval(const BayesNet<GUM_SCALAR>& bn) const {
+    Potential<GUM_SCALAR> ASTplus<GUM_SCALAR>::eval(const IBayesNet<GUM_SCALAR>& bn) const {
         using namespace std;
         if(this->_verbose_) cout << "EVAL operation + " << endl;
         auto res = this->_op1_->eval(bn) + this->_op2_->eval(bn);
@@ -182,7 +182,7 @@ namespace gum{
     }
 
     template<typename GUM_SCALAR>
-    Potential<GUM_SCALAR> ASTminus<GUM_SCALAR>::eval(const BayesNet<GUM_SCALAR>& bn) const {
+    Potential<GUM_SCALAR> ASTminus<GUM_SCALAR>::eval(const IBayesNet<GUM_SCALAR>& bn) const {
         using namespace std;
         if(this->_verbose_) cout << "EVAL operation - " << endl;
         auto res = this->_op1_->eval(bn) - this->_op2_->eval(bn);
@@ -225,7 +225,7 @@ namespace gum{
     }
 
     template<typename GUM_SCALAR>
-    Potential<GUM_SCALAR> ASTmult<GUM_SCALAR>::eval(const BayesNet<GUM_SCALAR>& bn) const {
+    Potential<GUM_SCALAR> ASTmult<GUM_SCALAR>::eval(const IBayesNet<GUM_SCALAR>& bn) const {
         using namespace std;
         if(this->_verbose_) cout << "EVAL operation * " << endl;
         auto res = this->_op1_->eval(bn) * this->_op2_->eval(bn);
@@ -268,7 +268,7 @@ namespace gum{
     }
 
     template<typename GUM_SCALAR>
-    Potential<GUM_SCALAR> ASTdiv<GUM_SCALAR>::eval(const BayesNet<GUM_SCALAR>& bn) const {
+    Potential<GUM_SCALAR> ASTdiv<GUM_SCALAR>::eval(const IBayesNet<GUM_SCALAR>& bn) const {
         using namespace std;
         if(this->_verbose_) cout << "EVAL operation / " << endl;
         auto res = this->_op1_->eval(bn) / this->_op2_->eval(bn);
@@ -317,6 +317,16 @@ namespace gum{
         GUM_CONS_CPY(ASTPosteriorProba);
     }
 
+    template<typename GUM_SCALAR>
+    ASTPosteriorProba<GUM_SCALAR>::ASTPosteriorProba(
+        const ASTPosteriorProba<GUM_SCALAR>& other,
+        const std::shared_ptr<NameSet> varset,
+        const std::shared_ptr<NameSet> knwset)
+        : ASTtree<GUM_SCALAR>(other), _bn_(other._bn_), _varset_(varset), _knwset_(knwset)
+    {
+        GUM_CONSTRUCTOR(ASTPosteriorProba);
+    }
+
     template<typename GUM_SCALAR>
     ASTPosteriorProba<GUM_SCALAR>::~ASTPosteriorProba() {
         GUM_DESTRUCTOR(ASTPosteriorProba);
@@ -362,7 +372,7 @@ namespace gum{
     }
 
     template<typename GUM_SCALAR>
-    Potential<GUM_SCALAR> ASTPosteriorProba<GUM_SCALAR>::eval(const BayesNet<GUM_SCALAR>& bn) const {
+    Potential<GUM_SCALAR> ASTPosteriorProba<GUM_SCALAR>::eval(const IBayesNet<GUM_SCALAR>& bn) const {
         using namespace std;
         if(this->getVerbosity()) cout << "EVAL $" << _to_latex_({}) << "$ in context" << std::endl; 
         auto ie = LazyPropagation(bn);
@@ -419,7 +429,7 @@ namespace gum{
     }
 
     template<typename GUM_SCALAR> // TODO: this function crashes...
-    Potential<GUM_SCALAR> ASTJointProba<GUM_SCALAR>::eval(const BayesNet<GUM_SCALAR>& bn) const {
+    Potential<GUM_SCALAR> ASTJointProba<GUM_SCALAR>::eval(const IBayesNet<GUM_SCALAR>& bn) const {
         using namespace std;
         if(this->getVerbosity()) cout << "EVAL $" << _to_latex_() << "$ in context" << endl;
         auto ie = LazyPropagation<GUM_SCALAR>(&bn);
@@ -506,10 +516,10 @@ namespace gum{
     }
 
     template<typename GUM_SCALAR>
-    Potential<GUM_SCALAR> ASTsum<GUM_SCALAR>::eval(const BayesNet<GUM_SCALAR>& bn) const{
+    Potential<GUM_SCALAR> ASTsum<GUM_SCALAR>::eval(const IBayesNet<GUM_SCALAR>& bn) const{
         using namespace std;
         if(this->getVerbosity()) cout << "EVAL $" << _to_latex_() << "$" << endl;
-        const auto res = term().eval(bn).margSumOut(Set({&bn.variable(var())}));
+        const auto res = term().eval(bn).margSumOut(Set({&bn.variableFromName(var())}));
         if(this->getVerbosity()) cout << "END OF EVAL $" << _to_latex_() << "$ : " << res << endl;
         return res;
     }
@@ -558,6 +568,53 @@ namespace gum{
         return "\\left(" + _to_latex_(nameOccur) + "\\right)";
     }
 
+    template<typename GUM_SCALAR, typename Rename>
+    std::unique_ptr<ASTtree<GUM_SCALAR>> renamedTree(const ASTtree<GUM_SCALAR>& tree, const Rename& rename){
+        const auto renamedSet = [&](const NameSet& names){
+            auto res = std::make_shared<NameSet>();
+            for(const auto& n : names) res->insert(rename(n));
+            return res;
+        };
+        const auto typ = tree.type();
+        if(typ == "_posterior_"){
+            const auto& p = static_cast<const ASTPosteriorProba<GUM_SCALAR>&>(tree);
+            return std::make_unique<ASTPosteriorProba<GUM_SCALAR>>(p, renamedSet(p.vars()), renamedSet(p.knw()));
+        }
+        if(typ == "_joint_")
+            return std::make_unique<ASTJointProba<GUM_SCALAR>>(renamedSet(static_cast<const ASTJointProba<GUM_SCALAR>&>(tree).vars()));
+        if(typ == "_sum_"){
+            const auto& s = static_cast<const ASTsum<GUM_SCALAR>&>(tree);
+            return std::make_unique<ASTsum<GUM_SCALAR>>(std::vector<std::string>({rename(s.var())}), renamedTree(s.term(), rename));
+        }
+
+        const auto& b = static_cast<const ASTBinaryOp<GUM_SCALAR>&>(tree);
+        auto op1 = renamedTree(b.op1(), rename);
+        auto op2 = renamedTree(b.op2(), rename);
+        if(typ == "+") return std::make_unique<ASTplus<GUM_SCALAR>>(std::move(op1), std::move(op2));
+        if(typ == "-") return std::make_unique<ASTminus<GUM_SCALAR>>(std::move(op1), std::move(op2));
+        if(typ == "*") return std::make_unique<ASTmult<GUM_SCALAR>>(std::move(op1), std::move(op2));
+        if(typ == "/") return std::make_unique<ASTdiv<GUM_SCALAR>>(std::move(op1), std::move(op2));
+        GUM_ERROR(NotImplementedYet, "no renaming of the ASTtree nodes of type " << typ)
+    }
+
+    template<typename GUM_SCALAR>
+    NameSet variablesOf(const ASTtree<GUM_SCALAR>& tree){
+        const auto typ = tree.type();
+        if(typ == "_posterior_"){
+            const auto& p = static_cast<const ASTPosteriorProba<GUM_SCALAR>&>(tree);
+            return p.vars() + p.knw();
+        }
+        if(typ == "_joint_") return static_cast<const ASTJointProba<GUM_SCALAR>&>(tree).vars();
+        if(typ == "_sum_"){
+            const auto& s = static_cast<const ASTsum<GUM_SCALAR>&>(tree);
+            auto res = variablesOf(s.term());
+            res.insert(s.var());
+            return res;
+        }
+        const auto& b = static_cast<const ASTBinaryOp<GUM_SCALAR>&>(tree);
+        return variablesOf(b.op1()) + variablesOf(b.op2());
+    }
+
     // I know, I know, a bit ugly, but this was by far the most elegant solution compared to CRTP clone semantics 
     // or even copy-pasting the whole function by hand everywhere
     #define ___ASTtree_clone_function_injector_MACRO___(ASTtype) \
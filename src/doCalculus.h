@@ -7,6 +7,9 @@
 #include "CausalFormula.h"
 #include "exceptions.h"
 #include "dSeparation.h"
+#include "mutilatedGraphView.h"
+#include "causalSubModelView.h"
+#include "causalADMG.h"
 #include "agrum/tools/graphs/undiGraph.h"
 
 #include <sstream>
@@ -65,11 +68,31 @@ namespace gum{
      * @param Y The variables of interest (named following the paper)
      * @param X The variable of intervention (named following the paper)
      * @param P The ASTtree representing the calculus in construction
+     * @param useViews whether the recursion works on @ref CausalSubModelView 
+     * (true) or on deep copies built by @ref inducedCausalSubModel (false)
      * @return ASTtree the ASTtree representing the calculus
+     * @note a model that is not semi-Markovian (see @ref isSemiMarkovian) is 
+     * replaced by its @ref latentProjection first
      */
     template<typename GUM_SCALAR>
     std::unique_ptr<ASTtree<GUM_SCALAR>> identifyingIntervention(
-        const CausalModel<GUM_SCALAR>& cm, const NameSet& Y, const NameSet& X, std::unique_ptr<ASTtree<GUM_SCALAR>> P);
+        const CausalModel<GUM_SCALAR>& cm, const NameSet& Y, const NameSet& X, std::unique_ptr<ASTtree<GUM_SCALAR>> P, 
+        bool useViews = true);
+
+    /**
+     * @brief The identification algorithm (see above) on an ADMG : the 
+     * c-components are the districts of its bidirected edges and the 
+     * recursion works on induced ADMGs, no latent node being involved
+     * 
+     * @param admg the causal model as an ADMG
+     * @param Y The variables of interest (named following the paper)
+     * @param X The variable of intervention (named following the paper)
+     * @param P The ASTtree representing the calculus in construction
+     * @return ASTtree the ASTtree representing the calculus
+     */
+    template<typename GUM_SCALAR>
+    std::unique_ptr<ASTtree<GUM_SCALAR>> identifyingIntervention(
+        const CausalADMG<GUM_SCALAR>& admg, const NameSet& Y, const NameSet& X, std::unique_ptr<ASTtree<GUM_SCALAR>> P);
 
     /**
      * @brief Create a CausalFormula representing a backdoor zset from x to y in the causal mode lcm
@@ -95,6 +118,35 @@ namespace gum{
     template<typename GUM_SCALAR>
     ASTtree<GUM_SCALAR> getFrontDoorTree(const CausalModel<GUM_SCALAR>& cm,const std::string& x,const std::string& y,const NodeSet& zset);
 
+    /**
+     * @brief Create an AdsT representing a conditional frontdoor zset from x to y 
+     * given the observations w in the causal model : 
+     * $\sum_z P(z|x,w) \sum_{x'} P(y|x',z,w) P(x'|w)$
+     * 
+     * @param cm causal model
+     * @param x impacting node
+     * @param y impacted node
+     * @param zset conditional frontdoor set
+     * @param knowing the observed nodes w
+     * @return ASTtree the ASTtree for the conditional frontdoor criterion
+     */
+    template<typename GUM_SCALAR>
+    ASTtree<GUM_SCALAR> getFrontDoorTree(const CausalModel<GUM_SCALAR>& cm,const std::string& x,const std::string& y,const NodeSet& zset,const NameSet& knowing);
+
+    /**
+     * @brief Create an ASTtree representing the adjustment on zset for the 
+     * effect of the set of nodes X on the set of nodes Y in the causal model cm : 
+     * $\sum_Z P(Y|X,Z) P(Z)$
+     * 
+     * @param cm causal model
+     * @param X impacting nodes
+     * @param Y impacted nodes
+     * @param zset adjustment set
+     * @return ASTtree the ASTtree for the generalized adjustment criterion
+     */
+    template<typename GUM_SCALAR>
+    ASTtree<GUM_SCALAR> getAdjustmentTree(const CausalModel<GUM_SCALAR>& cm, const NameSet& X, const NameSet& Y, const NodeSet& zset);
+
 }
 
 
@@ -25,23 +25,9 @@ namespace gum{
         auto iKnowing = Set<NodeId>({});
         for(auto x : knowing) iKnowing.insert(cm.idFromName(x));
 
-        auto removedArcs = std::vector<std::pair<NodeId, NodeId>>();
-        for(const auto& id : iDoing){
-            for(const auto& p : cm.parents(id)){
-                cm.eraseCausalArc(p, id);
-                removedArcs.push_back(make_pair(p, id));
-            }
-        }
-        for(const auto& id : iKnowing){
-            for(const auto& c : cm.children(id)){
-                cm.eraseCausalArc(id, c);
-                removedArcs.push_back(make_pair(id, c));
-            }
-        }
-        auto rg = dSep_reduce(cm, iDoing + iOn + iKnowing);
-        for(const auto& arc : removedArcs){
-            cm.addCausalArc(arc.head, arc.tail);
-        }
+        // G without the arcs entering the interventions nor leaving the observations
+        const auto mutilated = MutilatedGraphView(cm, iDoing, iKnowing);
+        auto rg = dSep_reduce(mutilated, iDoing + iOn + iKnowing);
         for(const auto& id : iKnowing){
             if(isDSep(rg, Set({id}), iOn, iDoing + (iKnowing - Set({id})))){
                 try{
@@ -55,43 +41,8 @@ namespace gum{
         return CausalFormula(cm, ASTdiv(p.root(), q.root()), on, doing, knowing);
     }
     
-    void __undiComponent(UndiGraph& g, NodeId n, NodeSet& se){
-        for(const auto& i : g.neighbours(n)){
-            if(se.contains(i)) continue;
-            se.insert(i);
-            __undiComponent(g, i, se);
-        }
-    };
-
-    template<typename GUM_SCALAR>
-    std::vector<Set<NodeId>> _cDecomposition(const CausalModel<GUM_SCALAR>& cm){
-        auto undi = UndiGraph();
-        auto s = cm.nodes() - cm.latentVariablesIds();
-        for(const auto& n : s) undi.addNodeWithId(n);
-        for(const auto& latent : cm.latentVariablesIds()){
-            auto chils = cm.children(latent);
-            for(auto x1 = chils.beginSafe(); x1 != chils.endSafe(); ++x1){
-                for(auto x2 = x1+1; x2 != chils.endSafe(); ++x2){
-                    undi.addEdge(x1, x2);
-                }
-            }
-        }
-
-        auto components = std::vector<Set<NodeId>>();
-        while(s.size() != 0){
-            auto c = *s.begin();
-            s.erase(s.begin());
-            auto sc = Set({c});
-            __undiComponent(undi, c, sc);
-            s -= sc;
-            components.push_back(sc);
-        }
-        return components;
-    }
-
-
-    template<typename GUM_SCALAR>
-    std::vector<int> _topological_sort(const CausalModel<GUM_SCALAR>& cm) {
+    template<typename ModelT>
+    std::vector<int> _topological_sort(const ModelT& cm) {
         auto lt = cm.latentVariablesIds();
         auto dc = HashTable<NodeId, size_t>();
         for(const auto& i : cm.nodes() - lt) dc[i] = (cm.parents(i) - lt).size();
@@ -114,22 +65,82 @@ namespace gum{
 
 
     
+    /// internal : the sub-model of a recursion on deep copies
+    template<typename GUM_SCALAR>
+    CausalModel<GUM_SCALAR> _II_induced_(const CausalModel<GUM_SCALAR>& cm, const NodeSet& nodes){
+        return inducedCausalSubModel(cm, nodes);
+    }
+
+    /// internal : the sub-model of a recursion on views
+    template<typename GUM_SCALAR>
+    CausalSubModelView<GUM_SCALAR> _II_induced_(const CausalSubModelView<GUM_SCALAR>& cm, const NodeSet& nodes){
+        return cm.induced(nodes);
+    }
+
+    /// internal : the sub-model of a recursion on an ADMG
+    template<typename GUM_SCALAR>
+    CausalADMG<GUM_SCALAR> _II_induced_(const CausalADMG<GUM_SCALAR>& cm, const NodeSet& nodes){
+        return cm.induced(nodes);
+    }
+
+    /**
+     * @brief internal : the identification algorithm on a causal model, a
+     * view of one or an ADMG (``ModelT``), the sub-models of the recursion 
+     * being of the same kind (see @ref _II_induced_)
+     *
+     * The recursion works on the node ids, which the sub-models keep : the
+     * names are only looked up (by id) to build the nodes of the formula.
+     */
+    template<typename GUM_SCALAR, typename ModelT>
+    std::unique_ptr<ASTtree<GUM_SCALAR>> _identifyingIntervention_(
+        const ModelT& cm, const NodeSet& iY, const NodeSet& iX, std::unique_ptr<ASTtree<GUM_SCALAR>> P);
+
+    /// internal : the names of the nodes ``ids`` of ``cm``
+    template<typename ModelT>
+    NameSet _II_names_(const ModelT& cm, const NodeSet& ids){
+        auto res = NameSet();
+        const auto& names = cm.names();
+        for(const auto& i : ids) res.insert(names[i]);
+        return res;
+    }
+
+    /// internal : the nodes of the names ``names`` of ``cm``, looked up once before the recursion
+    template<typename ModelT>
+    NodeSet _II_ids_(const ModelT& cm, const NameSet& names){
+        auto res = NodeSet();
+        for(const auto& x : names) res.insert(cm.idFromName(x));
+        return res;
+    }
+
+    template<typename GUM_SCALAR>
+    std::unique_ptr<ASTtree<GUM_SCALAR>> identifyingIntervention(
+        const CausalModel<GUM_SCALAR>& cm, const NameSet& Y, const NameSet& X, std::unique_ptr<ASTtree<GUM_SCALAR>> P,
+        bool useViews)
+    {
+        // the formula only refers to the observed variables : the smaller projection gives the same one
+        if(!isSemiMarkovian(cm))
+            return identifyingIntervention(latentProjection(cm), Y, X, std::move(P), useViews);
+        if(useViews) return _identifyingIntervention_(CausalSubModelView<GUM_SCALAR>(cm), _II_ids_(cm, Y), _II_ids_(cm, X), std::move(P));
+        return _identifyingIntervention_(cm, _II_ids_(cm, Y), _II_ids_(cm, X), std::move(P));
+    }
+
     template<typename GUM_SCALAR>
     std::unique_ptr<ASTtree<GUM_SCALAR>> identifyingIntervention(
-        const CausalModel<GUM_SCALAR>& cm, const NameSet& Y, const NameSet& X, std::unique_ptr<ASTtree<GUM_SCALAR>> P)
+        const CausalADMG<GUM_SCALAR>& admg, const NameSet& Y, const NameSet& X, std::unique_ptr<ASTtree<GUM_SCALAR>> P)
+    {
+        return _identifyingIntervention_(admg, _II_ids_(admg, Y), _II_ids_(admg, X), std::move(P));
+    }
+
+    template<typename GUM_SCALAR, typename ModelT>
+    std::unique_ptr<ASTtree<GUM_SCALAR>> _identifyingIntervention_(
+        const ModelT& cm, const NodeSet& iY, const NodeSet& iX, std::unique_ptr<ASTtree<GUM_SCALAR>> P)
         { 
         // TODO: giga-tester ce truc
-        auto iX = Set<NodeId>();
-        for(const auto& x : X) iX.insert(cm.idFromName(x));
-        auto iY = Set<NodeId>();
-        for(const auto& x : Y) iY.insert(cm.idFromName(x));
         auto iV = cm.nodes() - cm.latentVariablesIds();
-        auto V = Set<std::string>();
-        for(const auto& x : iV) V.insert(cm.names()[x]);
 
         // step 1 --------------------------
-        if(X.size() == 0){
-            auto vy = V - Y;
+        if(iX.size() == 0){
+            auto vy = _II_names_(cm, iV - iY);
             if(vy.size() != 0){
                 return ASTsum(vy.begin(), vy.end(), std::move(P));
             }
@@ -142,91 +153,68 @@ namespace gum{
             ancestor(i, cm, iAnY);
         }
         iAnY += iY;
-        auto AnY = Set<std::string>();
-        for(auto x : iAnY) AnY.insert(cm.names()[x]);
 
-        if(cm.nodes().size() != AnY.size()){
-            auto ivAny = iV - iAnY;
-            auto vAny = Set<std::string>();
-            for(const auto& x : ivAny) vAny.insert(cm.names()[x]);
+        if(cm.nodes().size() != iAnY.size()){
+            auto vAny = _II_names_(cm, iV - iAnY);
             P = ASTsum(vAny, std::move(P));
-            return identifyingIntervention(inducedCausalSubModel(cm, iAnY), Y, X + AnY, P);
+            return _identifyingIntervention_(_II_induced_(cm, iAnY), iY, iX + iAnY, std::move(P));
         }
 
         // step 3 -------------------------
-        auto rmArcs = Set<std::pair<NodeId, NodeId>>();
-
-        for(const auto& e : iX){
-            for(const auto& p : cm.parents(e)){
-                cm.eraseCausalArc(p, e);
-                rmArcs.insert(make_pair(p, e));
-            }
-        }
-        
+        const auto gx = cut_incoming_arcs(cm, iX);
         auto ianY = NodeSet();
         for(const auto& i : iY){
-            ancestor(i, cm, ianY);
+            ancestor(i, gx, ianY);
         }
         ianY += iY;
         auto iW = (iV - iX) - ianY;
 
-        for(const auto& arc : rmArcs){
-            cm.addCausalArc(arc.head, arc.tail);
-        }
-
         if(iW.size() != 0){
-            auto W = Set<std::string>();
-            for(const auto& x : iW) W.insert(cm.names()[x]);
-            return identifyingIntervention(cm, Y, X + W, std::move(P));
+            return _identifyingIntervention_(cm, iY, iX + iW, std::move(P));
         }
 
-        auto gvx = inducedCausalSubModel(cm, iV - iX);
-        auto cd = std::vector<Set<std::string>>();
-        auto icd = _cDecomposition(gvx);
-        for(const auto& s : icd){
-            auto temp = Set<std::string>();
-            for(const auto& x : s) temp.insert(cm.names()[x]);
-            cd.push_back(temp);
-        }
+        auto gvx = _II_induced_(cm, iV - iX);
+        auto icd = gvx.cComponents();
 
         // step 4 ----------------------------------
-        if(cd.size() > 1){
-            auto t = identifyingIntervention(cm, cd[0], V - cd[0], std::move(P));
-            for(auto si = ++cd.begin(); si != cd.end(); ++si){
-                t = ASTmult<GUM_SCALAR>(identifyingIntervention(cm, si, V - *si, std::make_unique<ASTtree<GUM_SCALAR>>(*P)), t);
+        if(icd.size() > 1){
+            auto t = _identifyingIntervention_(cm, icd[0], iV - icd[0], std::move(P));
+            for(auto si = ++icd.begin(); si != icd.end(); ++si){
+                t = ASTmult<GUM_SCALAR>(_identifyingIntervention_(cm, *si, iV - *si, std::make_unique<ASTtree<GUM_SCALAR>>(*P)), t);
             }
-            auto vyx = V - (X + Y);
+            auto vyx = _II_names_(cm, iV - (iX + iY));
             
             if(vyx.size() == 0) return t;
             return ASTsum(vyx.begin(), vyx.end(), std::move(t));
         }
 
-        auto S = cd[0];
         auto iS = icd[0];
-        auto cdg = _cDecomposition(cm);
+        auto cdg = cm.cComponents();
 
         // step 5 ---------------------------------
-        if(cdg.size() == 1 && cdg[0].size() == V.size()){
+        if(cdg.size() == 1 && cdg[0].size() == iV.size()){
+            const auto V = _II_names_(cm, iV);
             auto ss = std::stringstream();
-            ss << "Hedge Error: G=" << V << ", G[S]=" << S;
+            ss << "Hedge Error: G=" << V << ", G[S]=" << _II_names_(cm, iS);
             throw HedgeException(ss.str().c_str(), V);
         }
 
 
         // step 6 --------------------------------
-        auto gs = inducedCausalSubModel(cm, iS);
+        auto gs = _II_induced_(cm, iS);
         if(std::find(cdg.begin(), cdg.end(), gs.nodes() - gs.latentVariablesIds()) != cdg.end()){
             auto prb = std::vector<ASTtree<GUM_SCALAR>>();
             auto to = _topological_sort(cm);
-            for(const auto& v : S){
-                auto vpi = std::find(to.begin(), to.end(), cm.idFromName(v));
+            for(const auto& v_id : iS){
+                const auto& v = cm.names()[v_id];
+                auto vpi = std::find(to.begin(), to.end(), v_id);
                 if(vpi == to.begin() || vpi == to.end()){
                     prb.push_back(ASTJointProba({v}));
                 }else{
                     if(P == nullptr){
                         auto nvpi = Set<std::string>();
                         for(auto i=to.begin(); i!=vpi; ++i) nvpi.insert(cm.names()[*i]);
-                        prb.push_back(ASTPosteriorProba(cm.causalBN(), Set({v}), nvpi));
+                        prb.push_back(ASTPosteriorProba(cm.observationalBN(), Set({v}), nvpi));
                     }else{
                         prb.push_back(ASTdiv(std::make_unique(P), ASTsum(v, std::make_unique(P))));
                     }
@@ -234,7 +222,7 @@ namespace gum{
             }
 
             auto prod = productOfTrees(prb);
-            auto SminY = S - Y;
+            auto SminY = _II_names_(cm, iS - iY);
             if((SminY).size() == 0) return prod;
 
             return ASTsum(SminY, prod);
@@ -247,26 +235,23 @@ namespace gum{
             auto top = _topological_sort(cm);
 
             for(const auto& v_id : ispr){
-                auto v = cm.names()[v_id];
-                auto vpi = std::find(top.begin(), top.end(), cm.idFromName(v));
+                const auto& v = cm.names()[v_id];
+                auto vpi = std::find(top.begin(), top.end(), v_id);
                 if(vpi == top.begin() || vpi == top.end()){
                     prb.push_back(ASTjointProba({v}));
                 }else{
                     auto nvpi = Set<std::string>();
                     for(auto i=top.begin(); i!=vpi; ++i) nvpi.insert(cm.names()[*i]);
-                    prb.push_back(ASTPosteriorProba(cm.causalBN(), Set({v}), nvpi));
+                    prb.push_back(ASTPosteriorProba(cm.observationalBN(), Set({v}), nvpi));
                 }
             }
             auto P = productOfTrees(prb);
-            NameSet Xspr = X;
-            for(const auto& v_id : ispr) Xspr.insert(cm.names()[v_id]);
-            return identifyingIntervention(inducedCausalSubModel(cm, ispr), Y, Xspr, P);
+            return _identifyingIntervention_(_II_induced_(cm, ispr), iY, iX + ispr, std::move(P));
         }
 
         return nullptr;
     }
 
-    
     template<typename GUM_SCALAR>
     ASTtree<GUM_SCALAR> getBackDoorTree(const CausalModel<GUM_SCALAR>& cm, const std::string& x, const std::string& y, const NodeSet& zset) {
 
@@ -274,7 +259,7 @@ namespace gum{
         for(const auto& i : zset) zp.push_back(cm.names()[i]);
         auto zps = Set(zp);
         zps.insert(x);
-        return ASTsum(zp, ASTmult(ASTposteriorProba(cm.causalBN(), Set({y}), zps), 
+        return ASTsum(zp, ASTmult(ASTposteriorProba(cm.observationalBN(), Set({y}), zps), 
             ASTJointProba<GUM_SCALAR>(zp)));
     }
 
@@ -285,7 +270,31 @@ namespace gum{
         for(const auto& i : zset) zp.push_back(cm.names()[i]);
         auto zps = Set(zp);
         zps.insert(x);
-        return ASTsum(zp, ASTmult(ASTposteriorProba(cm.causalBN(), Set(zp), Set({x})), 
-            ASTsum({x}, ASTmult(ASTposteriorProba(cm.causalBN(), Set({y}), zps)), ASTJointProba<GUM_SCALAR>({x}))));
+        return ASTsum(zp, ASTmult(ASTposteriorProba(cm.observationalBN(), Set(zp), Set({x})), 
+            ASTsum({x}, ASTmult(ASTposteriorProba(cm.observationalBN(), Set({y}), zps), ASTJointProba<GUM_SCALAR>({x})))));
+    }
+
+
+    template<typename GUM_SCALAR>
+    ASTtree<GUM_SCALAR> getFrontDoorTree(const CausalModel<GUM_SCALAR>& cm,const std::string& x,const std::string& y,const NodeSet& zset,const NameSet& knowing) {
+        if(knowing.size() == 0) return getFrontDoorTree(cm, x, y, zset);
+
+        auto zp = std::vector<std::string>();
+        for(const auto& i : zset) zp.push_back(cm.names()[i]);
+        auto zps = Set(zp) + knowing;
+        zps.insert(x);
+        return ASTsum(zp, ASTmult(ASTposteriorProba(cm.observationalBN(), Set(zp), Set({x}) + knowing), 
+            ASTsum({x}, ASTmult(ASTposteriorProba(cm.observationalBN(), Set({y}), zps), ASTposteriorProba(cm.observationalBN(), Set({x}), knowing)))));
+    }
+    
+    template<typename GUM_SCALAR>
+    ASTtree<GUM_SCALAR> getAdjustmentTree(const CausalModel<GUM_SCALAR>& cm, const NameSet& X, const NameSet& Y, const NodeSet& zset) {
+        if(zset.size() == 0) return ASTposteriorProba(cm.observationalBN(), Y, X);
+
+        auto zp = std::vector<std::string>();
+        for(const auto& i : zset) zp.push_back(cm.names()[i]);
+        auto zps = Set(zp) + X;
+        return ASTsum(zp, ASTmult(ASTposteriorProba(cm.observationalBN(), Y, zps), 
+            ASTJointProba<GUM_SCALAR>(zp)));
     }
-}
\ No newline at end of file
+}
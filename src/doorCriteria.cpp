@@ -2,6 +2,10 @@
 #include "dSeparation.h"
 
 #include <agrum/tools/core/set.h>
+#include <agrum/tools/core/hashTable.h>
+#include <stdexcept>
+#include <algorithm>
+#include <bit>
 
 #ifdef GUM_NO_INLINE
 #  include "doorCriteria_inl.h"
@@ -29,8 +33,17 @@ namespace gum{
         _doors_(backdoors),
         _selection_mask_(selection_mask),
         _selection_size_(selection_size),
-        _cur_(cur)
+        _cur_(cur),
+        _fingerprint_(0),
+        _constraints_(),
+        _excluded_(),
+        _names_(nullptr),
+        _order_(nullptr),
+        _word_(0),
+        _doorWords_()
     {
+        if(_possible_ != nullptr && _possible_->size() <= 64)
+            _order_ = std::make_shared<const std::vector<NodeId>>(_possible_->begin(), _possible_->end());
         GUM_CONSTRUCTOR(DoorIterator)
     }
     
@@ -53,7 +66,14 @@ namespace gum{
         _doors_(std::move(v._doors_)),
         _selection_mask_(std::move(v._selection_mask_)),
         _selection_size_(std::exchange(v._selection_size_, 0)),
-        _cur_(std::move(v._cur_))
+        _cur_(std::move(v._cur_)),
+        _fingerprint_(std::exchange(v._fingerprint_, 0)),
+        _constraints_(std::move(v._constraints_)),
+        _excluded_(std::move(v._excluded_)),
+        _names_(std::move(v._names_)),
+        _order_(std::move(v._order_)),
+        _word_(std::exchange(v._word_, 0)),
+        _doorWords_(std::move(v._doorWords_))
     {
         GUM_CONS_MOV(DoorIterator)
     }
@@ -69,7 +89,14 @@ namespace gum{
         _doors_(v._doors_),
         _selection_mask_(v._selection_mask_),
         _selection_size_(v._selection_size_),
-        _cur_(v._cur_)
+        _cur_(v._cur_),
+        _fingerprint_(v._fingerprint_),
+        _constraints_(v._constraints_),
+        _excluded_(v._excluded_),
+        _names_(v._names_),
+        _order_(v._order_),
+        _word_(v._word_),
+        _doorWords_(v._doorWords_)
     {
         GUM_CONS_CPY(DoorIterator)
     }
@@ -85,6 +112,13 @@ namespace gum{
         _selection_mask_ = std::move(v._selection_mask_);
         _selection_size_ = std::exchange(v._selection_size_, 0);
         _cur_ = std::move(v._cur_);
+        _fingerprint_ = std::exchange(v._fingerprint_, 0);
+        _constraints_ = std::move(v._constraints_);
+        _excluded_ = std::move(v._excluded_);
+        _names_ = std::move(v._names_);
+        _order_ = std::move(v._order_);
+        _word_ = std::exchange(v._word_, 0);
+        _doorWords_ = std::move(v._doorWords_);
         GUM_OP_MOV(DoorIterator)
         return *this;
     }
@@ -100,12 +134,20 @@ namespace gum{
         _selection_mask_ = v._selection_mask_;
         _selection_size_ = v._selection_size_;
         _cur_ = v._cur_;
+        _fingerprint_ = v._fingerprint_;
+        _constraints_ = v._constraints_;
+        _excluded_ = v._excluded_;
+        _names_ = v._names_;
+        _order_ = v._order_;
+        _word_ = v._word_;
+        _doorWords_ = v._doorWords_;
         GUM_OP_CPY(DoorIterator)
         return *this;
     }
 
     BackdoorIterator::BackdoorIterator
-        (const std::shared_ptr<DAG> G, const std::shared_ptr<NodeSet> possible, NodeId cause, NodeId effect)
+        (const std::shared_ptr<DAG> G, const std::shared_ptr<NodeSet> possible, NodeId cause, NodeId effect, 
+         const BackdoorConstraints& constraints)
         : DoorIterator(
             false, 
             false,
@@ -116,22 +158,27 @@ namespace gum{
             gum::Set<NodeSet>(), 
             std::vector<bool>(possible->size(), false), 
             0,
-            NodeSet({}))
+            NodeSet({})),
+          _separator_(nullptr),
+          _fallback_(nullptr)
     {
+        _constraints_ = constraints;
+        if(_order_ != nullptr && G->size() <= 64)
+            _separator_ = std::make_shared<const SmallBackdoorSeparator>(*G, cause, effect, *_order_, constraints.required);
         GUM_CONSTRUCTOR(BackdoorIterator)
     }
     BackdoorIterator::BackdoorIterator()
-        : DoorIterator(false)
+        : DoorIterator(false), _separator_(nullptr), _fallback_(nullptr)
     {
         GUM_CONSTRUCTOR(BackdoorIterator)
     }
     BackdoorIterator::BackdoorIterator(BackdoorIterator&& v)
-        : DoorIterator(v)
+        : DoorIterator(v), _separator_(std::move(v._separator_)), _fallback_(std::move(v._fallback_))
     {
         GUM_CONS_MOV(BackdoorIterator)
     }
     BackdoorIterator::BackdoorIterator(const BackdoorIterator& v)
-        : DoorIterator(v)
+        : DoorIterator(v), _separator_(v._separator_), _fallback_(v._fallback_)
     {
         GUM_CONS_CPY(BackdoorIterator)
     }
@@ -140,15 +187,137 @@ namespace gum{
     }
     BackdoorIterator& BackdoorIterator::operator=(BackdoorIterator&& o) {
         DoorIterator::operator=(o);
+        _separator_ = std::move(o._separator_);
+        _fallback_ = std::move(o._fallback_);
         GUM_OP_MOV(BackdoorIterator)
         return *this;
     }
     BackdoorIterator& BackdoorIterator::operator=(const BackdoorIterator& o) {
         DoorIterator::operator=(o);
+        _separator_ = o._separator_;
+        _fallback_ = o._fallback_;
         GUM_OP_CPY(BackdoorIterator)
         return *this;
     }
+
+    SmallBackdoorSeparator::SmallBackdoorSeparator(const DAG& G, NodeId cause, NodeId effect, const std::vector<NodeId>& order, const NodeSet& required)
+        : _causeBit_(0), _effectBit_(0), _requiredWord_(0), _ancestors_(), _parents_(), _children_()
+    {
+        // the candidates take the bits given by their position, the other nodes the remaining ones
+        const auto cg = CompactDigraph(G);
+        auto bit = std::vector<Size>(cg.bound(), 64);
+        const Size n = order.size();
+        for(Size j = 0; j < n; j++) bit[order[j]] = n - 1 - j;
+        Size next = n;
+        for(NodeId v = 0; v < cg.bound(); v++)
+            if(cg.exists(v) && bit[v] == 64) bit[v] = next++;
+
+        _causeBit_ = uint64_t(1) << bit[cause];
+        _effectBit_ = uint64_t(1) << bit[effect];
+        for(const auto& r : required) _requiredWord_ |= uint64_t(1) << bit[r];
+        _ancestors_.assign(next, 0);
+        _parents_.assign(next, 0);
+        _children_.assign(next, 0);
+        for(const auto v : cg.topologicalOrder()){
+            auto& anc = _ancestors_[bit[v]];
+            anc = uint64_t(1) << bit[v];
+            for(const auto p : cg.parents(v)){
+                anc |= _ancestors_[bit[p]];
+                if(p == cause) continue;
+                _parents_[bit[v]] |= uint64_t(1) << bit[p];
+                _children_[bit[p]] |= uint64_t(1) << bit[v];
+            }
+        }
+        GUM_CONSTRUCTOR(SmallBackdoorSeparator)
+    }
+
+    bool SmallBackdoorSeparator::separated(uint64_t zword) const {
+        zword |= _requiredWord_;
+        // moral graph of the ancestral set, the arcs out of the cause being removed
+        auto ancestral = _ancestors_[std::countr_zero(_causeBit_)] | _ancestors_[std::countr_zero(_effectBit_)];
+        for(auto w = zword; w != 0; w &= w - 1) ancestral |= _ancestors_[std::countr_zero(w)];
+        const auto allowed = ancestral & ~zword;
+
+        auto reached = _causeBit_;
+        auto frontier = _causeBit_;
+        while(frontier != 0){
+            const auto u = std::countr_zero(frontier);
+            frontier &= frontier - 1;
+            const auto ch = _children_[u] & ancestral;
+            auto nb = _parents_[u] | ch;
+            for(auto w = ch; w != 0; w &= w - 1) nb |= _parents_[std::countr_zero(w)]; // married parents
+            nb &= allowed & ~reached;
+            if(nb & _effectBit_) return false;
+            reached |= nb;
+            frontier |= nb;
+        }
+        return true;
+    }
     
+    bool SmallBackdoorSeparator::extensible(uint64_t in, uint64_t free) const {
+        auto ancestral = _ancestors_[std::countr_zero(_causeBit_)] | _ancestors_[std::countr_zero(_effectBit_)];
+        for(auto w = in | _requiredWord_; w != 0; w &= w - 1) ancestral |= _ancestors_[std::countr_zero(w)];
+        return separated(in | (free & ancestral));
+    }
+
+    /// the first node of ``s``, standing for the whole set in the base iterator
+    static NodeId _AI_first_(const NodeSet& s, const char* what){
+        if(s.empty()) GUM_ERROR(InvalidArgument, "an adjustment set needs at least one " << what)
+        return *s.begin();
+    }
+
+    AdjustmentIterator::AdjustmentIterator
+        (const std::shared_ptr<DAG> G, const std::shared_ptr<NodeSet> possible, 
+         const std::shared_ptr<const NodeSet> causes, const std::shared_ptr<const NodeSet> effects)
+        : DoorIterator(
+            false, 
+            false,
+            G, 
+            possible, 
+            _AI_first_(*causes, "cause"), 
+            _AI_first_(*effects, "effect"), 
+            gum::Set<NodeSet>(), 
+            std::vector<bool>(possible->size(), false), 
+            0,
+            NodeSet({})),
+          _causes_(causes),
+          _effects_(effects)
+    {
+        GUM_CONSTRUCTOR(AdjustmentIterator)
+    }
+    AdjustmentIterator::AdjustmentIterator()
+        : DoorIterator(false), _causes_(nullptr), _effects_(nullptr)
+    {
+        GUM_CONSTRUCTOR(AdjustmentIterator)
+    }
+    AdjustmentIterator::AdjustmentIterator(AdjustmentIterator&& v)
+        : DoorIterator(v), _causes_(std::move(v._causes_)), _effects_(std::move(v._effects_))
+    {
+        GUM_CONS_MOV(AdjustmentIterator)
+    }
+    AdjustmentIterator::AdjustmentIterator(const AdjustmentIterator& v)
+        : DoorIterator(v), _causes_(v._causes_), _effects_(v._effects_)
+    {
+        GUM_CONS_CPY(AdjustmentIterator)
+    }
+    AdjustmentIterator::~AdjustmentIterator() {
+        GUM_DESTRUCTOR(AdjustmentIterator)
+    }
+    AdjustmentIterator& AdjustmentIterator::operator=(AdjustmentIterator&& o) {
+        DoorIterator::operator=(o);
+        _causes_ = std::move(o._causes_);
+        _effects_ = std::move(o._effects_);
+        GUM_OP_MOV(AdjustmentIterator)
+        return *this;
+    }
+    AdjustmentIterator& AdjustmentIterator::operator=(const AdjustmentIterator& o) {
+        DoorIterator::operator=(o);
+        _causes_ = o._causes_;
+        _effects_ = o._effects_;
+        GUM_OP_CPY(AdjustmentIterator)
+        return *this;
+    }
+
 
     DoorIterator::reference DoorIterator::operator*() const { 
         return _cur_; 
@@ -175,6 +344,7 @@ namespace gum{
         if(a._cause_ != b._cause_ || a._effect_ != b._effect_) return false;
         if(a._selection_size_ != b._selection_size_) return false;
         if(a._selection_mask_ != b._selection_mask_) return false;
+        if(a._word_ != b._word_) return false;
         if(a._cur_ != b._cur_) return false;
         return a._doors_ == b._doors_;
     }
@@ -183,38 +353,365 @@ namespace gum{
     }
 
     bool BackdoorIterator::_next_(){
-        if(!_advance_selection_mask_()) return false; 
-        _gen_cur_();
-        bool worth_testing = true;
-        for(auto& s : _doors_){
-            if(s.isSubsetOrEqual(_cur_)) worth_testing = false;
+        while(true){
+            if(_separator_ != nullptr){
+                // everything on words : the selection is only expanded once accepted
+                while(_advance_selection_mask_()){
+                    if(_dominated_() || !_separator_->separated(_word_)) continue;
+                    _gen_cur_();
+                    _add_door_();
+                    return true;
+                }
+            }else{
+                while(_advance_selection_mask_()){
+                    _gen_cur_();
+                    if(_dominated_() || !isDSep_parents(*_G_, NodeSet({_cause_}), NodeSet({_effect_}), _cur_)) continue; // invalid set
+                    _add_door_();
+                    return true;
+                }
+            }
+            if(_fallback_ == nullptr) return false;
+            _useFallback_();
         }
-        if(worth_testing && isDSep_parents(*_G_, NodeSet({_cause_}), NodeSet({_effect_}), _cur_)){
-            _doors_.insert(_cur_);
-            return true;
-        }else{
-            return _next_(); // skip this as this is an invalid set
+    }
+
+    void BackdoorIterator::_useFallback_(){
+        // a door of the preferred candidates is minimal among all the sets (its subsets are 
+        // preferred too) : the doors found so far only dominate the new selections
+        _possible_ = std::move(_fallback_);
+        _fallback_ = nullptr;
+        _selection_mask_.assign(_possible_->size(), false);
+        _selection_size_ = 0;
+        _word_ = 0;
+        _order_ = nullptr;
+        _separator_ = nullptr;
+        _doorWords_.clear();
+        if(_possible_->size() > 64) return;
+
+        _order_ = std::make_shared<const std::vector<NodeId>>(_possible_->begin(), _possible_->end());
+        if(_G_->size() <= 64)
+            _separator_ = std::make_shared<const SmallBackdoorSeparator>(*_G_, _cause_, _effect_, *_order_, _constraints_.required);
+        const auto n = _order_->size();
+        for(const auto& d : _doors_){
+            uint64_t w = 0;
+            for(Size j = 0; j < n; j++)
+                if(d.contains((*_order_)[j])) w |= uint64_t(1) << (n - 1 - j);
+            _doorWords_.push_back(w);
         }
     }
 
+
+    AdjustmentIterator& AdjustmentIterator::operator++() {
+        if(_next_()) return *this;
+        _is_the_end_ = true;
+        return *this;
+    }
+    AdjustmentIterator AdjustmentIterator::operator++(int) {
+        AdjustmentIterator tmp = *this; ++(*this); 
+        return tmp;
+    }
+
+    bool AdjustmentIterator::_next_(){
+        // _G_ is the proper backdoor graph and the candidates are not forbidden:
+        // only the separation remains to be checked
+        while(_advance_selection_mask_()){
+            _gen_cur_();
+            if(_dominated_()) continue;
+            if(isDSep(*_G_, *_causes_, *_effects_, _cur_)){
+                _add_door_();
+                return true;
+            }
+        }
+        return false;
+    }
     
     void DoorIterator::_gen_cur_(){
         _cur_.clear();
-        int i=0;
-        for(const auto& el : *_possible_){
-            if(!_selection_mask_[i++]) continue;
-            _cur_.insert(el);
+        if(_order_ != nullptr){
+            const auto n = _order_->size();
+            for(auto w = _word_; w != 0; w &= w - 1) 
+                _cur_.insert((*_order_)[n - 1 - std::countr_zero(w)]);
+        }else{
+            int i=0;
+            for(const auto& el : *_possible_){
+                if(!_selection_mask_[i++]) continue;
+                _cur_.insert(el);
+            }
         }
+        _cur_ += _constraints_.required;
     }
+
+    /// the ``k`` lowest bits set
+    static uint64_t _DI_low_bits_(Size k){
+        return k >= 64 ? ~uint64_t(0) : (uint64_t(1) << k) - 1;
+    }
+
     bool DoorIterator::_advance_selection_mask_(){
         if(_is_the_end_) return false;
+        if(_order_ != nullptr){
+            const auto n = _order_->size();
+            const auto full = _DI_low_bits_(n);
+            if(_selection_size_ > 0 && _word_ != _DI_low_bits_(_selection_size_)){
+                // previous word with as many bits : complement of the next 
+                // word of the complement (Gosper's hack)
+                const auto y = ~_word_ & full;
+                const auto c = y & (~y + 1);
+                const auto r = y + c;
+                _word_ = ~(r | (((y ^ r) >> 2) >> std::countr_zero(c))) & full;
+                return true;
+            }
+            _selection_size_++;
+            if(_selection_size_ > n) return false;
+            if(_selection_size_ + _constraints_.required.size() > _constraints_.maxSize) return false;
+            _word_ = full & ~_DI_low_bits_(n - _selection_size_);
+            return true;
+        }
         bool x = std::prev_permutation(_selection_mask_.begin(), _selection_mask_.end());
         if(x) return true;
 
         _selection_size_++;
         if(_selection_size_ > _selection_mask_.size()) return false;
+        if(_selection_size_ + _constraints_.required.size() > _constraints_.maxSize) return false;
         std::fill(_selection_mask_.begin(), _selection_mask_.begin() + _selection_size_, true);
         std::fill(_selection_mask_.begin() + _selection_size_, _selection_mask_.end() , false);
         return true;
     }
-}
\ No newline at end of file
+
+    bool DoorIterator::_dominated_() const {
+        if(_order_ != nullptr){
+            for(const auto w : _doorWords_)
+                if((w & ~_word_) == 0) return true;
+            return false;
+        }
+        for(auto& s : _doors_){
+            if(s.isSubsetOrEqual(_cur_)) return true;
+        }
+        return false;
+    }
+
+    void DoorIterator::_add_door_(){
+        _doors_.insert(_cur_);
+        if(_order_ != nullptr) _doorWords_.push_back(_word_);
+    }
+
+    static void _CUR_put_(std::vector<uint8_t>& blob, uint64_t v){
+        for(int i = 0; i < 8; i++) blob.push_back(uint8_t(v >> (8 * i)));
+    }
+
+    static uint64_t _CUR_get_(const std::vector<uint8_t>& blob, size_t& pos){
+        if(pos + 8 > blob.size()) throw std::invalid_argument("Truncated door cursor.");
+        uint64_t v = 0;
+        for(int i = 0; i < 8; i++) v |= uint64_t(blob[pos++]) << (8 * i);
+        return v;
+    }
+
+    std::vector<uint8_t> DoorCursor::serialize() const {
+        auto blob = std::vector<uint8_t>({'D', 'C', 'U', 'R', version});
+        blob.push_back(is_front_door ? 1 : 0);
+        blob.push_back(is_the_end ? 1 : 0);
+        _CUR_put_(blob, fingerprint);
+        _CUR_put_(blob, cause);
+        _CUR_put_(blob, effect);
+        for(const auto set : {&constraints.forbidden, &constraints.required, &constraints.allowed}){
+            _CUR_put_(blob, set->size());
+            for(const auto& n : *set) _CUR_put_(blob, n);
+        }
+        _CUR_put_(blob, constraints.maxSize);
+        _CUR_put_(blob, excluded.size());
+        for(const auto& n : excluded) _CUR_put_(blob, n);
+        _CUR_put_(blob, possible.size());
+        for(const auto& n : possible) _CUR_put_(blob, n);
+        _CUR_put_(blob, selection_size);
+        _CUR_put_(blob, selection_mask.size());
+        uint8_t byte = 0;
+        for(size_t i = 0; i < selection_mask.size(); i++){
+            if(selection_mask[i]) byte |= uint8_t(1) << (i % 8);
+            if(i % 8 == 7 || i + 1 == selection_mask.size()){
+                blob.push_back(byte);
+                byte = 0;
+            }
+        }
+        _CUR_put_(blob, doors.size());
+        for(const auto& d : doors){
+            _CUR_put_(blob, d.size());
+            for(const auto& n : d) _CUR_put_(blob, n);
+        }
+        _CUR_put_(blob, current.size());
+        for(const auto& n : current) _CUR_put_(blob, n);
+        _CUR_put_(blob, names.size());
+        for(const auto& [n, name] : names){
+            _CUR_put_(blob, n);
+            _CUR_put_(blob, name.size());
+            blob.insert(blob.end(), name.begin(), name.end());
+        }
+        return blob;
+    }
+
+    DoorCursor DoorCursor::parse(const std::vector<uint8_t>& blob){
+        if(blob.size() < 7 || blob[0] != 'D' || blob[1] != 'C' || blob[2] != 'U' || blob[3] != 'R')
+            throw std::invalid_argument("Not a door cursor.");
+        if(blob[4] > version || blob[4] < 1) 
+            throw std::invalid_argument("Unsupported door cursor version.");
+
+        auto cur = DoorCursor();
+        size_t pos = 5;
+        cur.is_front_door = blob[pos++] != 0;
+        cur.is_the_end = blob[pos++] != 0;
+        cur.fingerprint = _CUR_get_(blob, pos);
+        cur.cause = _CUR_get_(blob, pos);
+        cur.effect = _CUR_get_(blob, pos);
+        for(auto n = _CUR_get_(blob, pos); n > 0; n--) cur.constraints.forbidden.insert(_CUR_get_(blob, pos));
+        if(blob[4] >= 2){
+            for(auto n = _CUR_get_(blob, pos); n > 0; n--) cur.constraints.required.insert(_CUR_get_(blob, pos));
+            for(auto n = _CUR_get_(blob, pos); n > 0; n--) cur.constraints.allowed.insert(_CUR_get_(blob, pos));
+            cur.constraints.maxSize = _CUR_get_(blob, pos);
+        }
+        if(blob[4] >= 3){
+            for(auto n = _CUR_get_(blob, pos); n > 0; n--) cur.excluded.insert(_CUR_get_(blob, pos));
+        }else if(cur.is_front_door){
+            // the first set was the excluded nodes of a frontdoor enumeration
+            cur.excluded = cur.constraints.forbidden;
+            cur.constraints.forbidden.clear();
+        }
+        for(auto n = _CUR_get_(blob, pos); n > 0; n--) cur.possible.push_back(_CUR_get_(blob, pos));
+        cur.selection_size = _CUR_get_(blob, pos);
+        const auto nmask = _CUR_get_(blob, pos);
+        if(pos + (nmask + 7) / 8 > blob.size()) throw std::invalid_argument("Truncated door cursor.");
+        cur.selection_mask.resize(nmask);
+        for(size_t i = 0; i < nmask; i++) cur.selection_mask[i] = (blob[pos + i / 8] >> (i % 8)) & 1;
+        pos += (nmask + 7) / 8;
+        for(auto n = _CUR_get_(blob, pos); n > 0; n--){
+            auto d = NodeSet();
+            for(auto k = _CUR_get_(blob, pos); k > 0; k--) d.insert(_CUR_get_(blob, pos));
+            cur.doors.insert(d);
+        }
+        if(blob[4] >= 4){
+            for(auto n = _CUR_get_(blob, pos); n > 0; n--) cur.current.insert(_CUR_get_(blob, pos));
+            for(auto n = _CUR_get_(blob, pos); n > 0; n--){
+                const auto id = _CUR_get_(blob, pos);
+                const auto len = _CUR_get_(blob, pos);
+                if(len > blob.size() - pos) throw std::invalid_argument("Truncated door cursor.");
+                cur.names.insert(id, std::string(blob.begin() + pos, blob.begin() + pos + len));
+                pos += len;
+            }
+        }
+        return cur;
+    }
+
+    DoorCursor DoorCursor::relabel(const HashTable<NodeId, NodeId>& ids) const {
+        const auto id = [&](NodeId n){
+            if(!ids.exists(n)) throw std::invalid_argument("The cursor refers to an unknown node.");
+            return ids[n];
+        };
+        const auto set = [&](const NodeSet& s){
+            auto res = NodeSet();
+            for(const auto& n : s) res.insert(id(n));
+            return res;
+        };
+        auto cur = *this;
+        cur.cause = id(cause);
+        cur.effect = id(effect);
+        cur.constraints.required = set(constraints.required);
+        cur.constraints.forbidden = set(constraints.forbidden);
+        cur.constraints.allowed = set(constraints.allowed);
+        cur.excluded = set(excluded);
+        for(auto& n : cur.possible) n = id(n);
+        cur.doors.clear();
+        for(const auto& d : doors) cur.doors.insert(set(d));
+        cur.current = set(current);
+        cur.names.clear();
+        for(const auto& [n, name] : names) cur.names.insert(id(n), name);
+        return cur;
+    }
+
+    std::vector<uint8_t> DoorIterator::checkpoint() const {
+        auto cur = DoorCursor();
+        cur.is_front_door = _is_front_door_;
+        cur.is_the_end = _is_the_end_;
+        cur.fingerprint = _fingerprint_;
+        cur.cause = _cause_;
+        cur.effect = _effect_;
+        cur.constraints = _constraints_;
+        cur.excluded = _excluded_;
+        if(_possible_) cur.possible.assign(_possible_->begin(), _possible_->end());
+        cur.selection_mask = _selection_mask_;
+        if(_order_ != nullptr){
+            const auto n = _order_->size();
+            for(Size j = 0; j < n; j++) cur.selection_mask[j] = (_word_ >> (n - 1 - j)) & 1;
+        }
+        cur.selection_size = _selection_size_;
+        cur.doors = _doors_;
+        cur.current = _cur_;
+        if(_names_ != nullptr){
+            // the names of the nodes the cursor refers to, to match them on resume
+            auto nodes = NodeSet({cur.cause, cur.effect}) + cur.constraints.required + cur.constraints.forbidden 
+                + cur.constraints.allowed + cur.excluded + cur.current;
+            for(const auto& n : cur.possible) nodes.insert(n);
+            for(const auto& d : cur.doors) nodes += d;
+            for(const auto& n : nodes) cur.names.insert(n, (*_names_)[n]);
+        }
+        return cur.serialize();
+    }
+
+    void DoorIterator::_restore_(const DoorCursor& cursor){
+        if(cursor.is_the_end){
+            _is_the_end_ = true;
+            return;
+        }
+        // the candidates are rebuilt by the generator: their enumeration order 
+        // must be the one the mask was saved against
+        if(_possible_ == nullptr || cursor.cause != _cause_ || cursor.effect != _effect_)
+            throw std::invalid_argument("The cursor does not match this door enumeration.");
+        if(cursor.possible.size() != _possible_->size() || cursor.selection_mask.size() != _possible_->size())
+            throw std::invalid_argument("The cursor does not match this door enumeration.");
+        bool sameOrder = true;
+        size_t i = 0;
+        for(const auto& n : *_possible_){
+            if(cursor.possible[i++] == n) continue;
+            if(!_possible_->contains(cursor.possible[i - 1]))
+                throw std::invalid_argument("The cursor does not match this door enumeration.");
+            sameOrder = false;
+        }
+        // a cursor of version 3 at most does not know its current door: it is restored in its own order only
+        if(!sameOrder && cursor.current.empty())
+            throw std::invalid_argument("The cursor does not match this door enumeration.");
+
+        _is_the_end_ = false;
+        _doors_ = cursor.doors;
+        if(sameOrder){
+            _selection_mask_ = cursor.selection_mask;
+            _selection_size_ = cursor.selection_size;
+        }else{
+            // the model was rebuilt with other ids : the selections of the size of the cursor 
+            // are enumerated again, from the last selection of the previous size, and the 
+            // doors already found are dominated by themselves
+            const auto k = std::max(cursor.selection_size, size_t(1)) - 1;
+            _selection_mask_.assign(_possible_->size(), false);
+            std::fill(_selection_mask_.end() - k, _selection_mask_.end(), true);
+            _selection_size_ = k;
+        }
+        if(_order_ != nullptr){
+            const auto n = _order_->size();
+            auto bit = HashTable<NodeId, uint64_t>();
+            _word_ = 0;
+            for(Size j = 0; j < n; j++){
+                bit.insert((*_order_)[j], uint64_t(1) << (n - 1 - j));
+                if(_selection_mask_[j]) _word_ |= bit[(*_order_)[j]];
+            }
+            _doorWords_.clear();
+            for(const auto& d : _doors_){
+                uint64_t w = 0;
+                bool outside = false;
+                for(const auto& node : d){
+                    if(bit.exists(node)) w |= bit[node]; 
+                    else if(!_constraints_.required.contains(node)) outside = true;
+                }
+                // a door with a node that is neither a candidate nor required (a
+                // seeded frontdoor) dominates no selection
+                if(!outside) _doorWords_.push_back(w);
+            }
+        }
+        if(sameOrder) _gen_cur_();
+        else _cur_ = cursor.current;
+    }
+}
@@ -5,8 +5,17 @@
 
 #include <agrum/BN/BayesNet.h>
 #include <agrum/tools/core/set.h>
+#include <agrum/tools/core/hashTable.h>
+#include <memory>
 #include <string>
 #include <iterator>
+#include <vector>
+#include <cstdint>
+#include <optional>
+#include <limits>
+
+#include "reachability.h"
+#include "fingerprint.h"
 
 namespace gum{
     /**
@@ -28,7 +37,9 @@ namespace gum{
     /**
      * @brief Predicate on the existence of a directed path from 
      * ``x`` to ``y`` in the Bayesian network ``bn`` not blocked by nodes 
-     * of ``zset``
+     * of ``zset``, searched once on ``bn`` (see @ref exists_dipath). For 
+     * repeated queries on the same graph, give a @ref DipathOracle built 
+     * once to the overload below.
      * 
      * @tparam GUM_SCALAR 
      * @param bn the DAG model
@@ -45,6 +56,27 @@ namespace gum{
         const std::string& y,
         const gum::Set<std::string>& zset);
 
+    /**
+     * @brief Same predicate, answered by ``oracle`` (built on ``bn``), which is
+     * reused from one query to the next
+     * 
+     * @tparam GUM_SCALAR 
+     * @param oracle the directed path oracle of ``bn``
+     * @param bn the DAG model
+     * @param x name of source node
+     * @param y name of destination node
+     * @param zset names of the conditioning nodes
+     * @return true 
+     * @return false 
+     */
+    template<typename GUM_SCALAR>
+    bool exists_unblocked_directed_path(
+        const DipathOracle& oracle,
+        const gum::BayesNet<GUM_SCALAR>& bn, 
+        const std::string& x, 
+        const std::string& y,
+        const gum::Set<std::string>& zset);
+
     /**
      * @brief Tests whether or not ``zset`` satisifies the front 
      * door criterion for ``x`` and ``y``, in the Bayesian network ``bn``
@@ -64,6 +96,31 @@ namespace gum{
         const std::string& y, 
         const gum::Set<std::string>& zset);
 
+    /**
+     * @brief Tests whether or not ``zset`` satisfies the conditional front 
+     * door criterion for ``x`` and ``y`` given the observations ``wset``, 
+     * in the Bayesian network ``bn`` : ``zset`` intercepts every directed 
+     * path from ``x`` to ``y``, ``wset`` contains no descendant of ``x``, 
+     * ``wset`` blocks every backdoor path from ``x`` to ``zset`` and 
+     * ``wset + {x}`` blocks every backdoor path from ``zset`` to ``y``.
+     * 
+     * @tparam GUM_SCALAR 
+     * @param bn the DAG model
+     * @param x name of source node
+     * @param y name of destination node
+     * @param zset names of the mediating nodes
+     * @param wset names of the observed nodes
+     * @return true 
+     * @return false 
+     */
+    template<typename GUM_SCALAR>
+    bool is_conditional_frontdoor(
+        const gum::BayesNet<GUM_SCALAR>& bn, 
+        const std::string& x, 
+        const std::string& y, 
+        const gum::Set<std::string>& zset,
+        const gum::Set<std::string>& wset);
+
     /**
      * @brief  Tests whether or not ``zset`` satisifies the back door criterion for ``x`` and ``y``, in the Bayesian network ``bn``
      * 
@@ -80,7 +137,8 @@ namespace gum{
 
     /**
      * @brief Returns the set of nodes that can be reached through a
-     * backdoor path from ``a`` in the graph ``bn``
+     * backdoor path from ``a`` in the graph ``bn``. To get this set for 
+     * many nodes, build a @ref BackdoorReachIndex once instead.
      * 
      * @tparam GUM_SCALAR 
      * @param bn the DAG model
@@ -92,20 +150,158 @@ namespace gum{
 
     /**
      * @brief Returns the set of nodes through which there is a
-     * directed path from `x` to `y` in the graph `bn`
+     * directed path from `x` to `y` in the graph `bn`. 
+     * See @ref nodes_on_dipaths for the plain graph utility.
      * 
      * @tparam UM_SCALAR 
      * @param bn 
      * @param x 
      * @param y 
-     * @return const gum::NodeSet* 
+     * @return nullptr if there is no directed path from `x` to `y`, 
+     * otherwise the set of the intermediate nodes
      */
     template<typename GUM_SCALAR>
     std::unique_ptr<NodeSet> nodes_on_dipath(const BayesNet<GUM_SCALAR>& bn, NodeId x, NodeId y);
 
 
+    /**
+     * @brief Returns the nodes lying on a proper causal path from ``X`` 
+     * to ``Y`` (a directed path whose only node in ``X`` is the first one), 
+     * ``X`` excluded. The nodes of ``Y`` on such a path are included.
+     * 
+     * @tparam GraphT structure implementing a DAG-like interface
+     * @param g the graph
+     * @param X the causes
+     * @param Y the effects
+     * @return NodeSet 
+     */
+    template<typename GraphT>
+    NodeSet proper_causal_nodes(const GraphT& g, const NodeSet& X, const NodeSet& Y);
+
+    /**
+     * @brief Returns the set of nodes that can not belong to an adjustment 
+     * set for ``(X, Y)`` : ``X`` and the descendants of the nodes lying on a 
+     * proper causal path from ``X`` to ``Y`` (Shpitser et al., 2010).
+     * 
+     * @tparam GraphT structure implementing a DAG-like interface
+     * @param g the graph
+     * @param X the causes
+     * @param Y the effects
+     * @return NodeSet 
+     */
+    template<typename GraphT>
+    NodeSet adjustment_forbidden(const GraphT& g, const NodeSet& X, const NodeSet& Y);
+
+    /**
+     * @brief Returns the proper backdoor graph of ``g`` for ``(X, Y)`` : 
+     * ``g`` without the first arc of every proper causal path from ``X`` to ``Y``.
+     * 
+     * @tparam GraphT structure implementing a DAG-like interface
+     * @param g the graph
+     * @param X the causes
+     * @param Y the effects
+     * @return DAG 
+     */
+    template<typename GraphT>
+    DAG proper_backdoor_graph(const GraphT& g, const NodeSet& X, const NodeSet& Y);
+
+    /**
+     * @brief Tests whether or not ``zset`` satisfies the generalized 
+     * adjustment criterion for the sets of nodes ``X`` and ``Y`` : ``zset`` 
+     * contains no forbidden node (see @ref adjustment_forbidden) and 
+     * d-separates ``X`` from ``Y`` in the proper backdoor graph. 
+     * For a single cause and a single effect, every backdoor set is an 
+     * adjustment set.
+     * 
+     * @tparam GraphT structure implementing a DAG-like interface
+     * @param g the graph
+     * @param X the causes
+     * @param Y the effects
+     * @param zset the candidate adjustment set
+     * @return true 
+     * @return false 
+     */
+    template<typename GraphT>
+    bool is_adjustment(const GraphT& g, const NodeSet& X, const NodeSet& Y, const NodeSet& zset);
+
+    /**
+     * @brief Builds an adjustment set for ``(X, Y)`` avoiding the nodes of 
+     * ``not_adj`` (typically the latent variables), in O(|V|+|E|) plus one 
+     * d-separation test. The candidate is the set of ancestors of ``X + Y`` 
+     * that are neither forbidden nor excluded : an adjustment set avoiding 
+     * ``not_adj`` exists if and only if this candidate is one 
+     * (van der Zander et al., 2014).
+     * 
+     * @tparam GraphT structure implementing a DAG-like interface
+     * @param g the graph
+     * @param X the causes
+     * @param Y the effects
+     * @param not_adj the nodes that can not be adjusted on
+     * @return std::optional<NodeSet> the adjustment set if any
+     */
+    template<typename GraphT>
+    std::optional<NodeSet> adjustment_set(const GraphT& g, const NodeSet& X, const NodeSet& Y, const NodeSet& not_adj = NodeSet({}));
+
     // TODO: check if combinations.hpp etc are needed
 
+    /**
+     * @brief Constraints on the backdoor sets searched by @ref backdoor_generator. 
+     * They are applied during the search (candidates, size bound and existence 
+     * test), not on its output. The required, forbidden and size constraints are 
+     * hard ones, the allowed nodes only order the enumeration.
+     */
+    struct BackdoorConstraints {
+        NodeSet required;   //< nodes every set must contain
+        NodeSet forbidden;  //< nodes no set may contain
+        NodeSet allowed;    //< if not empty, the preferred nodes : the sets made of them (besides the required ones) come first
+        Size maxSize = std::numeric_limits<Size>::max(); //< maximal size of a set, required nodes included
+    };
+
+    /**
+     * @brief Decoded content of a door enumeration checkpoint, see 
+     * @ref DoorIterator::checkpoint. 
+     * 
+     * The byte layout is versioned; all integers are stored little-endian 
+     * on 64 bits.
+     */
+    struct DoorCursor {
+        static constexpr uint8_t version = 4;
+
+        bool is_front_door;
+        bool is_the_end;
+        uint64_t fingerprint;       //< canonical fingerprint of the model if the nodes are named, structural one otherwise
+        NodeId cause;
+        NodeId effect;
+        BackdoorConstraints constraints; //< the constraints of a backdoor enumeration
+        NodeSet excluded;           //< the nodes excluded by the caller of a frontdoor or adjustment enumeration
+        std::vector<NodeId> possible; //< candidate nodes, in enumeration order
+        std::vector<bool> selection_mask;
+        size_t selection_size;
+        Set<NodeSet> doors;         //< doors already found
+        NodeSet current;            //< the door the iterator pointed to (since version 4)
+        HashTable<NodeId, std::string> names; //< names of the nodes of the cursor, empty if the model was unnamed (since version 4)
+
+        /**
+         * @brief Encodes the cursor as a compact byte blob
+         */
+        std::vector<uint8_t> serialize() const;
+
+        /**
+         * @brief Decodes a byte blob produced by @ref serialize
+         * (the cursors of version 1, without constraints, and of version 2, storing the excluded 
+         * nodes of a frontdoor enumeration as forbidden ones, are accepted)
+         * @throw std::invalid_argument if the blob is truncated or not a door cursor
+         */
+        static DoorCursor parse(const std::vector<uint8_t>& blob);
+
+        /**
+         * @brief The cursor on the model whose node named ``names[n]`` has the id 
+         * ``ids[n]``, to resume it on a model rebuilt with other ids
+         * @throw std::invalid_argument if a node of the cursor has no new id
+         */
+        DoorCursor relabel(const HashTable<NodeId, NodeId>& ids) const;
+    };
+
     /**
      * @brief Base iterator class for iterating over backdoors of a BayesNet
      * In order to use this class, call backdoor_generator or frontdoor_generator.
@@ -131,6 +327,17 @@ namespace gum{
         std::vector<bool> _selection_mask_;
         size_t _selection_size_; //< inclusion mask for possible NodeSet
         value_type _cur_;
+        uint64_t _fingerprint_; //< fingerprint of the model being enumerated, canonical if the nodes are named
+        BackdoorConstraints _constraints_; //< constraints given by the caller of a backdoor enumeration, also kept to rebuild it
+        NodeSet _excluded_; //< nodes excluded by the caller of a frontdoor or adjustment enumeration, also kept to rebuild it
+        std::shared_ptr<const std::vector<std::string>> _names_; //< names of the nodes by id, stored in the checkpoints (nullptr if unnamed)
+
+        // word-packed enumeration, used when there are at most 64 candidates : 
+        // the j-th candidate is the bit (n-1-j) of the words, so that decreasing 
+        // words follow the order of the mask enumeration
+        std::shared_ptr<const std::vector<NodeId>> _order_; //< the candidates by position, nullptr if more than 64
+        uint64_t _word_;                      //< current selection
+        std::vector<uint64_t> _doorWords_;    //< the doors already found
 
         friend class BackdoorIterator;
         template<typename GUM_SCALAR>
@@ -156,6 +363,24 @@ namespace gum{
         bool _advance_selection_mask_();
         void _gen_cur_();
 
+        /// whether a door already found is included in the current selection (``_cur_`` must
+        /// be up to date when the candidates are not packed in words)
+        bool _dominated_() const;
+
+        /// records the current selection as a door
+        void _add_door_();
+
+        /**
+         * @brief Restores the enumeration state saved in ``cursor``. The 
+         * iterator must have been built by the generator from the same 
+         * model and arguments. If the candidates come in another order (the 
+         * model was rebuilt with other ids), the enumeration restarts at the 
+         * first selection of the size of the cursor, the doors already found 
+         * being skipped as dominated.
+         * @throw std::invalid_argument if the cursor does not match this enumeration
+         */
+        void _restore_(const DoorCursor& cursor);
+
     public:
         ~DoorIterator();
         DoorIterator(DoorIterator&& v);
@@ -175,11 +400,68 @@ namespace gum{
          * @return pointer 
          */
         pointer operator->() const;
+
+        /**
+         * @brief Saves the state of the enumeration (position, doors already 
+         * found and the model fingerprint) as a compact byte blob. 
+         * The enumeration can be resumed later at the same position with 
+         * @ref backdoor_generator_resume or @ref frontdoor_generator_resume,
+         * without replaying the sets already enumerated.
+         * 
+         * @return std::vector<uint8_t> the checkpoint
+         */
+        std::vector<uint8_t> checkpoint() const;
     };
 
     template<typename iter>
     class DoorIterable;
 
+    /**
+     * @brief Backdoor separation tests on a graph of at most 64 nodes, with 
+     * every node set (ancestors, parents, children, candidate sets) packed 
+     * in a 64-bit word. Equivalent to @ref isDSep_parents for a single cause
+     * and a single effect.
+     */
+    class SmallBackdoorSeparator {
+    private:
+        uint64_t _causeBit_;
+        uint64_t _effectBit_;
+        uint64_t _requiredWord_;           ///< the nodes added to every tested set
+        std::vector<uint64_t> _ancestors_; ///< ancestors of each node, the node included
+        std::vector<uint64_t> _parents_;   ///< parents of each node, the cause excepted
+        std::vector<uint64_t> _children_;  ///< children of each node, none for the cause
+
+    public:
+        /**
+         * @brief Packs ``G``. The candidate ``order[j]`` is given the bit 
+         * ``(n-1-j)`` where ``n`` is the number of candidates, as in the 
+         * words of @ref DoorIterator.
+         * 
+         * @param G the graph (at most 64 nodes)
+         * @param cause 
+         * @param effect 
+         * @param order the candidates
+         * @param required nodes added to every tested set
+         */
+        SmallBackdoorSeparator(const DAG& G, NodeId cause, NodeId effect, const std::vector<NodeId>& order, const NodeSet& required = NodeSet());
+        SmallBackdoorSeparator() = delete;
+
+        /**
+         * @brief Predicate on the candidates in ``zword`` (with the required 
+         * nodes) blocking every backdoor path from the cause to the effect
+         */
+        bool separated(uint64_t zword) const;
+
+        /**
+         * @brief Predicate on the existence of a separating set containing the 
+         * candidates of ``in`` and other candidates of ``free`` only : the 
+         * candidates of ``free`` that are ancestors of the cause, the effect, 
+         * ``in`` or the required nodes are added to ``in`` and tested 
+         * (van der Zander et al., 2014).
+         */
+        bool extensible(uint64_t in, uint64_t free) const;
+    };
+
     class BackdoorIterator : public DoorIterator {
     public:
         /**
@@ -201,13 +483,22 @@ namespace gum{
         BackdoorIterator& operator=(BackdoorIterator&& v);
         BackdoorIterator& operator=(const BackdoorIterator& v);
 
+        template<typename GraphT>
+        friend DoorIterable<BackdoorIterator> _BD_generator_(const GraphT&, NodeId, NodeId, const BackdoorConstraints&, uint64_t, std::shared_ptr<const std::vector<std::string>>);
         template<typename GUM_SCALAR>
-        friend DoorIterable<BackdoorIterator> backdoor_generator(const BayesNet<GUM_SCALAR>&, NodeId, NodeId, const NodeSet&);
+        friend DoorIterable<BackdoorIterator> backdoor_generator_resume(const BayesNet<GUM_SCALAR>&, const std::vector<uint8_t>&);
         template<typename iter>
         friend class DoorIterable;
+    private:
+        std::shared_ptr<const SmallBackdoorSeparator> _separator_; //< nullptr if the graph is too large
+        std::shared_ptr<NodeSet> _fallback_; //< all the candidates, enumerated once the preferred ones are exhausted (nullptr if none)
+
+        /// restarts the enumeration on the candidates of _fallback_, the doors found so far being kept
+        void _useFallback_();
     protected:
         BackdoorIterator();
-        BackdoorIterator(const std::shared_ptr<DAG> G, const std::shared_ptr<NodeSet> possible, NodeId cause, NodeId effect);
+        BackdoorIterator(const std::shared_ptr<DAG> G, const std::shared_ptr<NodeSet> possible, NodeId cause, NodeId effect, 
+            const BackdoorConstraints& constraints = BackdoorConstraints());
         bool _next_();
     };
     static_assert(std::input_iterator<BackdoorIterator>);
@@ -215,8 +506,14 @@ namespace gum{
     template<typename GUM_SCALAR>
     class FrontdoorIterator : public DoorIterator {
     private:
-        std::shared_ptr<BayesNet<GUM_SCALAR>> _bn_;
+        std::shared_ptr<const DipathOracle> _oracle_; //< directed path queries on the BN
         bool _nodiPath_;
+        std::shared_ptr<const std::vector<NodeId>> _seeds_; //< single-node frontdoors, yielded before the subsets of possible (nullptr if none computed)
+        size_t _seedPos_; //< number of seeds already yielded
+
+        /// positions the seeds after a @ref _restore_ of ``cursor`` and rebuilds the current set when it 
+        /// is not a selection of the mask (a seed, or a single candidate when there is no directed path)
+        void _restore_seeds_(const DoorCursor& cursor);
     public:
         /**
          * @brief x++ operator for FrontdoorIterator
@@ -238,17 +535,69 @@ namespace gum{
         FrontdoorIterator<GUM_SCALAR>& operator=(const FrontdoorIterator<GUM_SCALAR>& v);
 
 
+        template<typename S, typename GraphT>
+        friend DoorIterable<FrontdoorIterator<S>> _FD_generator_(const GraphT&, NodeId, NodeId, const BackdoorReachIndex&, const NodeSet&, uint64_t, std::shared_ptr<const std::vector<std::string>>);
         template<typename GUM_SCALAR>
-        friend DoorIterable<FrontdoorIterator<GUM_SCALAR>> frontdoor_generator(const BayesNet<GUM_SCALAR>&, NodeId, NodeId, const NodeSet&);
+        friend DoorIterable<FrontdoorIterator<GUM_SCALAR>> frontdoor_generator_resume(const BayesNet<GUM_SCALAR>&, const std::vector<uint8_t>&);
+        template<typename S, typename GraphT>
+        friend DoorIterable<FrontdoorIterator<S>> _FD_conditional_generator_(const GraphT&, NodeId, NodeId, const NodeSet&, const NodeSet&, uint64_t, std::shared_ptr<const std::vector<std::string>>);
         template<typename iter>
         friend class DoorIterable;
     protected:
         FrontdoorIterator();
-        FrontdoorIterator(const std::shared_ptr<BayesNet<GUM_SCALAR>> bn, const std::shared_ptr<NodeSet> possible, NodeId cause, NodeId effect, bool nodiPath);
+        FrontdoorIterator(const std::shared_ptr<const DipathOracle> oracle, const std::shared_ptr<NodeSet> possible, NodeId cause, NodeId effect, bool nodiPath,
+            const std::shared_ptr<const std::vector<NodeId>> seeds = nullptr);
         bool _next_();
     };
     // static_assert(std::input_iterator<FrontdoorIterator>);
 
+    class AdjustmentIterator;
+
+    // declared before its friend declaration : the default argument of a function template 
+    // can only be given by its first declaration (see the documented one below)
+    template<typename GraphT>
+    DoorIterable<AdjustmentIterator> adjustment_generator(const GraphT& g, const NodeSet& causes, const NodeSet& effects, const NodeSet& not_adj = NodeSet({}));
+
+    /**
+     * @brief Iterator over the minimal adjustment sets for a set of causes 
+     * and a set of effects. In order to use this class, call adjustment_generator.
+     */
+    class AdjustmentIterator : public DoorIterator {
+    private:
+        std::shared_ptr<const NodeSet> _causes_;
+        std::shared_ptr<const NodeSet> _effects_;
+    public:
+        /**
+         * @brief x++ operator for AdjustmentIterator
+         * @return AdjustmentIterator& 
+         */
+        AdjustmentIterator& operator++();
+
+        /**
+         * @brief WARNING, performs a complete copy of this structure! Potentially slow, always prefer ++x operator!!! 
+         * @return AdjustmentIterator 
+         * @warning WARNING, performs a complete copy of this structure! Potentially slow, always prefer ++x operator!!! 
+         */
+        AdjustmentIterator operator++(int);
+
+        AdjustmentIterator(AdjustmentIterator&& v);
+        AdjustmentIterator(const AdjustmentIterator& v);
+        ~AdjustmentIterator();
+        AdjustmentIterator& operator=(AdjustmentIterator&& v);
+        AdjustmentIterator& operator=(const AdjustmentIterator& v);
+
+        template<typename GraphT>
+        friend DoorIterable<AdjustmentIterator> adjustment_generator(const GraphT&, const NodeSet&, const NodeSet&, const NodeSet&);
+        template<typename iter>
+        friend class DoorIterable;
+    protected:
+        AdjustmentIterator();
+        AdjustmentIterator(const std::shared_ptr<DAG> G, const std::shared_ptr<NodeSet> possible, 
+            const std::shared_ptr<const NodeSet> causes, const std::shared_ptr<const NodeSet> effects);
+        bool _next_();
+    };
+    static_assert(std::input_iterator<AdjustmentIterator>);
+
     template<typename iter>
     class DoorIterable{ 
     private: 
@@ -268,12 +617,21 @@ namespace gum{
         INLINE iter begin() const; 
         INLINE iter end() const; 
 
+        template<typename GraphT>
+        friend DoorIterable<BackdoorIterator> _BD_generator_(const GraphT& g, NodeId cause, NodeId effect, const BackdoorConstraints& constraints, uint64_t fingerprint, std::shared_ptr<const std::vector<std::string>> names);
+        template<typename GUM_SCALAR, typename GraphT>
+        friend DoorIterable<FrontdoorIterator<GUM_SCALAR>> _FD_generator_(const GraphT& g, NodeId cause, NodeId effect, const BackdoorReachIndex& bdreach, const NodeSet& not_fd, uint64_t fingerprint, std::shared_ptr<const std::vector<std::string>> names);
         template<typename GUM_SCALAR>
-        friend DoorIterable<BackdoorIterator> backdoor_generator(const BayesNet<GUM_SCALAR>& bn, NodeId cause, NodeId effect, const NodeSet& not_bd);
+        friend DoorIterable<BackdoorIterator> backdoor_generator_resume(const BayesNet<GUM_SCALAR>& bn, const std::vector<uint8_t>& cursor);
         template<typename GUM_SCALAR>
-        friend DoorIterable<FrontdoorIterator<GUM_SCALAR>> frontdoor_generator(const BayesNet<GUM_SCALAR>& bn, NodeId cause, NodeId effect, const NodeSet& not_bd);
+        friend DoorIterable<FrontdoorIterator<GUM_SCALAR>> frontdoor_generator_resume(const BayesNet<GUM_SCALAR>& bn, const std::vector<uint8_t>& cursor);
+        template<typename GUM_SCALAR, typename GraphT>
+        friend DoorIterable<FrontdoorIterator<GUM_SCALAR>> _FD_conditional_generator_(const GraphT& g, NodeId cause, NodeId effect, const NodeSet& knowing, const NodeSet& not_fd, uint64_t fingerprint, std::shared_ptr<const std::vector<std::string>> names);
+        template<typename GraphT>
+        friend DoorIterable<AdjustmentIterator> adjustment_generator(const GraphT& g, const NodeSet& causes, const NodeSet& effects, const NodeSet& not_adj);
     };
     using BackdoorIterable = DoorIterable<BackdoorIterator>;
+    using AdjustmentIterable = DoorIterable<AdjustmentIterator>;
     template<typename GUM_SCALAR>
     using FrontdoorIterable = DoorIterable<FrontdoorIterator<GUM_SCALAR>>;
 
@@ -290,6 +648,72 @@ namespace gum{
     template<typename GUM_SCALAR>
     BackdoorIterable backdoor_generator(const BayesNet<GUM_SCALAR>& bn, NodeId cause, NodeId effect, const NodeSet& not_bd = NodeSet({}));
     
+    /**
+     * @brief Generates the backdoor sets for the pair of nodes `(cause, effect)` in the graph `bn` satisfying 
+     * `constraints` : every set contains the required nodes and a minimal set of other candidates. 
+     * Nothing is enumerated when no backdoor set satisfies the constraints besides the size bound 
+     * (see @ref constrained_backdoor_set), and the enumeration stops at the maximal size. When 
+     * some nodes are allowed, the sets made of allowed nodes are enumerated first (by increasing 
+     * size), then the other minimal sets. When the required nodes alone block every backdoor path 
+     * (the empty set when nothing is required, e.g. for a cause without parents), they are the 
+     * only set yielded.
+     * 
+     * @tparam GUM_SCALAR 
+     * @param bn 
+     * @param cause 
+     * @param effect 
+     * @param constraints 
+     * @return BackdoorIterable 
+     */
+    template<typename GUM_SCALAR>
+    BackdoorIterable backdoor_generator(const BayesNet<GUM_SCALAR>& bn, NodeId cause, NodeId effect, const BackdoorConstraints& constraints);
+
+    /**
+     * @brief internal : computes the reduced graph ``G`` and the candidate nodes ``possible`` 
+     * of a backdoor search under ``constraints`` (allowed or not)
+     * @return false if no backdoor set can satisfy the constraints
+     */
+    template<typename GraphT>
+    bool _BD_search_space_(const GraphT& g, NodeId cause, NodeId effect, const BackdoorConstraints& constraints, 
+                           std::shared_ptr<DAG>& G, std::shared_ptr<NodeSet>& possible);
+
+    /**
+     * @brief internal : the backdoor enumeration of @ref backdoor_generator on any DAG-like 
+     * graph, the iterator being stamped with ``fingerprint`` and the node ``names`` (nullptr if unnamed)
+     */
+    template<typename GraphT>
+    BackdoorIterable _BD_generator_(const GraphT& g, NodeId cause, NodeId effect, const BackdoorConstraints& constraints, uint64_t fingerprint, std::shared_ptr<const std::vector<std::string>> names);
+
+    /**
+     * @brief internal : @ref constrained_backdoor_set on any DAG-like graph
+     */
+    template<typename GraphT>
+    std::optional<NodeSet> _BD_constrained_set_(const GraphT& g, NodeId cause, NodeId effect, const BackdoorConstraints& constraints);
+
+    /**
+     * @brief internal : moves out of ``possible`` the nodes intercepting on their own every 
+     * directed path from ``cause`` to ``effect`` (the dominators of ``effect`` in the graph 
+     * rooted in ``cause``, see @ref DominatorTree), in the order they are met along the paths
+     */
+    template<typename GraphT>
+    std::shared_ptr<const std::vector<NodeId>> _FD_seeds_(const GraphT& g, NodeId cause, NodeId effect, NodeSet& possible);
+
+    /**
+     * @brief Decides if a backdoor set for `(cause, effect)` containing the required nodes and only 
+     * allowed, non forbidden nodes exists (the size bound is not considered). Such a set exists if 
+     * and only if the largest relevant candidate, the allowed non descendants of `cause` among the 
+     * ancestors of `cause`, `effect` and the required nodes, is one (van der Zander et al., 2014).
+     * 
+     * @tparam GUM_SCALAR 
+     * @param bn 
+     * @param cause 
+     * @param effect 
+     * @param constraints 
+     * @return std::optional<NodeSet> this largest backdoor set, nullopt if there is none
+     */
+    template<typename GUM_SCALAR>
+    std::optional<NodeSet> constrained_backdoor_set(const BayesNet<GUM_SCALAR>& bn, NodeId cause, NodeId effect, const BackdoorConstraints& constraints);
+
     /**
      * @brief Generates frontdoor sets for the pair of nodes `(cause, effect)` in the graph `bn` excluding the nodes in the set `not_fd` (optional)
      * 
@@ -302,6 +726,147 @@ namespace gum{
      */
     template<typename GUM_SCALAR>
     FrontdoorIterable<GUM_SCALAR> frontdoor_generator(const BayesNet<GUM_SCALAR>& bn, NodeId cause, NodeId effect, const NodeSet& not_fd = NodeSet({}));
+
+    /**
+     * @brief Generates frontdoor sets for the pair of nodes `(cause, effect)` in the graph `bn` excluding the nodes in the set `not_fd` (optional), 
+     * reading the backdoor reach of `cause` from a precomputed index
+     * 
+     * @tparam GUM_SCALAR 
+     * @param bn 
+     * @param cause 
+     * @param effect 
+     * @param bdreach index containing at least the backdoor reach of `cause`
+     * @param not_fd 
+     * @return BackdoorIterator 
+     */
+    template<typename GUM_SCALAR>
+    FrontdoorIterable<GUM_SCALAR> frontdoor_generator(const BayesNet<GUM_SCALAR>& bn, NodeId cause, NodeId effect, const BackdoorReachIndex& bdreach, const NodeSet& not_fd = NodeSet({}));
+
+    /**
+     * @brief internal : candidate nodes of a frontdoor search, the nodes on a directed path from 
+     * `cause` to `effect` (all the nodes if there is no such path, ``nodiPath`` being then set) 
+     * without a backdoor path from `cause` nor a backdoor path to `effect` not blocked by `cause`
+     */
+    template<typename GraphT>
+    std::shared_ptr<NodeSet> _FD_candidates_(const GraphT& g, NodeId cause, NodeId effect, const BackdoorReachIndex& bdreach, 
+                                             const NodeSet& not_fd, bool& nodiPath);
+
+    /**
+     * @brief internal : the frontdoor enumeration of @ref frontdoor_generator on any DAG-like 
+     * graph, the iterator being stamped with ``fingerprint`` and the node ``names`` (nullptr if unnamed)
+     */
+    template<typename GUM_SCALAR, typename GraphT>
+    FrontdoorIterable<GUM_SCALAR> _FD_generator_(const GraphT& g, NodeId cause, NodeId effect, const BackdoorReachIndex& bdreach, 
+                                                 const NodeSet& not_fd, uint64_t fingerprint, std::shared_ptr<const std::vector<std::string>> names);
+
+    /**
+     * @brief internal : the enumeration of @ref conditional_frontdoor_generator on any DAG-like 
+     * graph, the iterator being stamped with ``fingerprint`` and the node ``names`` (nullptr if unnamed)
+     */
+    template<typename GUM_SCALAR, typename GraphT>
+    FrontdoorIterable<GUM_SCALAR> _FD_conditional_generator_(const GraphT& g, NodeId cause, NodeId effect, const NodeSet& knowing, 
+                                                             const NodeSet& not_fd, uint64_t fingerprint, 
+                                                             std::shared_ptr<const std::vector<std::string>> names);
+
+    /**
+     * @brief Returns a frontdoor set for the pair of nodes `(cause, effect)` in the graph `bn` of minimal 
+     * total cost, excluding the nodes in the set `not_fd` (optional). 
+     * 
+     * The candidates of @ref frontdoor_generator are cut off by a minimum vertex cut (see @ref min_vertex_cut)
+     * separating `cause` from `effect`; each cut is checked with the whole frontdoor criterion and its 
+     * failing nodes are excluded from the next cut. Contrary to the generator, nothing is enumerated.
+     * 
+     * @tparam GUM_SCALAR 
+     * @param bn 
+     * @param cause 
+     * @param effect 
+     * @param costs the cost of each node, 1 for the missing ones (a minimum-cardinality set by default)
+     * @param not_fd 
+     * @return std::optional<NodeSet> nullopt if there is no frontdoor set
+     */
+    template<typename GUM_SCALAR>
+    std::optional<NodeSet> minimum_frontdoor_set(const BayesNet<GUM_SCALAR>& bn, NodeId cause, NodeId effect, 
+                                                 const HashTable<NodeId, double>& costs = HashTable<NodeId, double>(), 
+                                                 const NodeSet& not_fd = NodeSet({}));
+
+    /**
+     * @brief Generates conditional frontdoor sets (see @ref is_conditional_frontdoor) for the pair of nodes 
+     * `(cause, effect)` given the observed nodes `knowing` in the graph `bn`, excluding the nodes in the 
+     * set `not_fd` (optional). Nothing is enumerated if `knowing` contains a descendant of `cause`. 
+     * With no observation, this is @ref frontdoor_generator.
+     * 
+     * @tparam GUM_SCALAR 
+     * @param bn 
+     * @param cause 
+     * @param effect 
+     * @param knowing the observed nodes
+     * @param not_fd 
+     * @return FrontdoorIterable 
+     * @warning a conditional enumeration can not be resumed from a checkpoint
+     */
+    template<typename GUM_SCALAR>
+    FrontdoorIterable<GUM_SCALAR> conditional_frontdoor_generator(const BayesNet<GUM_SCALAR>& bn, NodeId cause, NodeId effect, const NodeSet& knowing, const NodeSet& not_fd = NodeSet({}));
+
+    /**
+     * @brief Generates the minimal adjustment sets for the sets of nodes `(causes, effects)` in the graph `g` 
+     * excluding the nodes in the set `not_adj` (optional), by increasing size. Nothing is enumerated 
+     * if no adjustment set exists (see @ref adjustment_set). 
+     * 
+     * @tparam GraphT structure implementing a DAG-like interface
+     * @param g 
+     * @param causes 
+     * @param effects 
+     * @param not_adj 
+     * @return AdjustmentIterable 
+     * @throw InvalidArgument if `causes` or `effects` is empty
+     */
+    template<typename GraphT>
+    AdjustmentIterable adjustment_generator(const GraphT& g, const NodeSet& causes, const NodeSet& effects, const NodeSet& not_adj);
+
+    /**
+     * @brief internal : the names of the variables of ``bn`` by node id, stored in the 
+     * checkpoints of the enumerations on ``bn``
+     */
+    template<typename GUM_SCALAR>
+    std::shared_ptr<const std::vector<std::string>> _DOOR_names_(const BayesNet<GUM_SCALAR>& bn);
+
+    /**
+     * @brief internal : decodes ``cursor`` and checks it against ``bn``, its node ids 
+     * being matched by name on ``bn`` (on the ids for an unnamed cursor)
+     * @throw std::invalid_argument if the cursor is malformed or stale
+     */
+    template<typename GUM_SCALAR>
+    DoorCursor _DOOR_parse_(const BayesNet<GUM_SCALAR>& bn, const std::vector<uint8_t>& cursor);
+
+    /**
+     * @brief Resumes a backdoor enumeration saved with @ref DoorIterator::checkpoint. 
+     * The returned iterable starts at the set the checkpointed iterator pointed to. 
+     * The nodes are matched by name, so ``bn`` may have been rebuilt with other ids.
+     * 
+     * @tparam GUM_SCALAR 
+     * @param bn the model the enumeration was started on
+     * @param cursor the checkpoint
+     * @return BackdoorIterable 
+     * @throw std::invalid_argument if the cursor is malformed, is not a backdoor 
+     * cursor, or was produced on a structurally different model (stale cursor)
+     */
+    template<typename GUM_SCALAR>
+    BackdoorIterable backdoor_generator_resume(const BayesNet<GUM_SCALAR>& bn, const std::vector<uint8_t>& cursor);
+
+    /**
+     * @brief Resumes a frontdoor enumeration saved with @ref DoorIterator::checkpoint. 
+     * The returned iterable starts at the set the checkpointed iterator pointed to. 
+     * The nodes are matched by name, so ``bn`` may have been rebuilt with other ids.
+     * 
+     * @tparam GUM_SCALAR 
+     * @param bn the model the enumeration was started on
+     * @param cursor the checkpoint
+     * @return FrontdoorIterable 
+     * @throw std::invalid_argument if the cursor is malformed, is not a frontdoor 
+     * cursor, or was produced on a structurally different model (stale cursor)
+     */
+    template<typename GUM_SCALAR>
+    FrontdoorIterable<GUM_SCALAR> frontdoor_generator_resume(const BayesNet<GUM_SCALAR>& bn, const std::vector<uint8_t>& cursor);
 };
 
 #include "doorCriteria_tpl.h"
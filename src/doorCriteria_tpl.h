@@ -1,6 +1,8 @@
 #include <agrum/BN/BayesNet.h>
 #include <agrum/tools/core/set.h>
 #include <string>
+#include <algorithm>
+#include <stdexcept>
 
 #include "doorCriteria.h"
 #include "dSeparation.h"
@@ -18,12 +20,22 @@ namespace gum{
         const std::string& y,
         const gum::Set<std::string>& zset)
         {
-        if(bn.children(x).contains(y)) return true;
+        auto zids = NodeSet();
+        for(const auto& z : zset) zids.insert(bn.idFromName(z));
+        return exists_dipath(bn, bn.idFromName(x), bn.idFromName(y), zids);
+    }
 
-        for(const auto& c : bn.children(x)){
-            if(!zset.contains(c) && exists_unblocked_directed_path(bn, c, y, zset)) return true; 
-        }
-        return false;
+    template<typename GUM_SCALAR>
+    bool exists_unblocked_directed_path(
+        const DipathOracle& oracle,
+        const gum::BayesNet<GUM_SCALAR>& bn, 
+        const std::string& x, 
+        const std::string& y,
+        const gum::Set<std::string>& zset)
+        {
+        auto zids = NodeSet();
+        for(const auto& z : zset) zids.insert(bn.idFromName(z));
+        return oracle.exists(bn.idFromName(x), bn.idFromName(y), zids);
     }
 
     template<typename GUM_SCALAR>
@@ -43,6 +55,35 @@ namespace gum{
         return true;
     }
 
+    template<typename GUM_SCALAR>
+    bool is_conditional_frontdoor(
+        const gum::BayesNet<GUM_SCALAR>& bn, 
+        const std::string& x, 
+        const std::string& y, 
+        const gum::Set<std::string>& zset,
+        const gum::Set<std::string>& wset)
+        {
+        if(wset.size() == 0) return is_frontdoor(bn, x, y, zset);
+        const auto ix = bn.idFromName(x);
+        const auto iy = bn.idFromName(y);
+        auto iz = NodeSet();
+        for(const auto& z : zset) iz.insert(bn.idFromName(z));
+        auto iw = NodeSet();
+        for(const auto& w : wset) iw.insert(bn.idFromName(w));
+
+        if(exists_dipath(bn, ix, iy, iz)) return false;
+        if((descendants(bn, ix) * iw).size() != 0) return false;
+        if((iz * iw).size() != 0) return false;
+
+        const auto xset = NodeSet({ix});
+        const auto wxset = iw + xset;
+        for(const auto& i : iz){
+            if(!isDSep_parents(bn, xset, NodeSet({i}), iw)) return false;
+            if(!isDSep_parents(bn, NodeSet({i}), NodeSet({iy}), wxset)) return false;
+        }
+        return true;
+    }
+
     template<typename GUM_SCALAR>
     bool is_backdoor(const gum::BayesNet<GUM_SCALAR>& bn, const std::string& x, const std::string& y, const gum::Set<std::string>& zset){
         const auto dex = descendants(bn, x);
@@ -52,77 +93,178 @@ namespace gum{
     }
 
     template<typename GUM_SCALAR>
-    void _BR_inner_br(
-        const gum::BayesNet<GUM_SCALAR>& bn, 
-        gum::NodeId x, bool pht, 
-        gum::NodeSet& reach0, 
-        gum::NodeSet& reach1)
-        {
-        for(const auto& c : bn.children(x)){
-            if(reach0.contains(c) || reach1.contains(c)) continue;
-            reach1.insert(c);
-            _BR_inner_br(bn, c, true, reach0, reach1);
+    gum::NodeSet backdoor_reach(const gum::BayesNet<GUM_SCALAR>& bn, gum::NodeId a){
+        return BackdoorReachIndex(bn, NodeSet({a})).reach(a);
+    }
+
+    template<typename GUM_SCALAR>
+    std::unique_ptr<NodeSet> nodes_on_dipath(const BayesNet<GUM_SCALAR>& bn, NodeId x, NodeId y){
+        auto res = _RCH_nodes_on_dipaths_(bn, x, y); // a single pass
+        if(!res) return nullptr;
+        return std::make_unique<NodeSet>(std::move(*res));
+    }
+
+    template<typename GraphT>
+    NodeSet proper_causal_nodes(const GraphT& g, const NodeSet& X, const NodeSet& Y){
+        const Size bound = g.nodes().bound();
+        // descendants of X by directed paths not going back through X
+        auto desc = std::vector<char>(bound, 0);
+        auto stack = std::vector<NodeId>(X.begin(), X.end());
+        while(!stack.empty()){
+            const auto n = stack.back();
+            stack.pop_back();
+            for(const auto& c : g.children(n)){
+                if(desc[c] || X.contains(c)) continue;
+                desc[c] = 1;
+                stack.push_back(c);
+            }
         }
-        if(pht) return;
-        for(const auto& p : bn.parents(x)){
-            if(reach0.contains(p)) continue;
-            reach0.insert(p);
-            _BR_inner_br(bn, p, false, reach0, reach1);
+
+        // ancestors of Y (Y included) by directed paths not going through X
+        auto anc = std::vector<char>(bound, 0);
+        for(const auto& y : Y){
+            if(X.contains(y) || anc[y]) continue;
+            anc[y] = 1;
+            stack.push_back(y);
+        }
+        while(!stack.empty()){
+            const auto n = stack.back();
+            stack.pop_back();
+            for(const auto& p : g.parents(n)){
+                if(anc[p] || X.contains(p)) continue;
+                anc[p] = 1;
+                stack.push_back(p);
+            }
         }
+
+        auto res = NodeSet();
+        for(const auto& n : g.nodes()){
+            if(desc[n] && anc[n]) res.insert(n);
+        }
+        return res;
     }
 
-    template<typename GUM_SCALAR>
-    gum::NodeSet backdoor_reach(const gum::BayesNet<GUM_SCALAR>& bn, gum::NodeId a){
-        const auto r = gum::Set({a});
-        r += bn.parents(a);
-        const auto l = gum::Set({a});
-        for(const auto& pa : bn.parents(a)){
-            _BR_inner_br(bn, pa, false, r, l);
+    template<typename GraphT>
+    NodeSet adjustment_forbidden(const GraphT& g, const NodeSet& X, const NodeSet& Y){
+        auto mark = std::vector<char>(g.nodes().bound(), 0);
+        for(const auto& n : proper_causal_nodes(g, X, Y)){
+            if(mark[n]) continue;
+            mark[n] = 1;
+            _RCH_mark_(g, n, true, mark);
         }
-        auto s = r + l;
-        if(s.contains(a)) s.erase(a);
-        return s;
+        auto res = X;
+        for(const auto& n : g.nodes()){
+            if(mark[n]) res.insert(n);
+        }
+        return res;
     }
 
-    template<typename GUM_SCALAR>
-    std::unique_ptr<NodeSet> _NOD_inner_nod(BayesNet<GUM_SCALAR> bn, NodeId a, NodeId b){
-        if(a == b) return std::make_unique<NodeSet>();
-        auto inners = std::make_unique<NodeSet>({a});
-        auto chds = bn.children(a);
-        if(chds.size() == 0) return nullptr;
-        bool found = false;
-        for(const auto& c : chds){
-            auto s = _NOD_inner_nod(bn, c, b);
-            if(s){
-                found = true;
-                *inners += *s;
+    template<typename GraphT>
+    DAG proper_backdoor_graph(const GraphT& g, const NodeSet& X, const NodeSet& Y){
+        const auto pcp = proper_causal_nodes(g, X, Y);
+        auto d = DAG();
+        for(const auto& n : g.nodes()) d.addNodeWithId(n);
+        for(const auto& n : g.nodes()){
+            const bool inX = X.contains(n);
+            for(const auto& c : g.children(n)){
+                if(inX && pcp.contains(c)) continue;
+                d.addArc(n, c);
             }
         }
-        if(found) return std::move(inners);
-        return nullptr;
+        return d;
     }
 
-    template<typename GUM_SCALAR>
-    std::unique_ptr<NodeSet> nodes_on_dipath(const BayesNet<GUM_SCALAR>& bn, NodeId x, NodeId y){
-        auto r = _NOD_inner_nod(bn, x, y);
-        if(r) r.remove(x);
-        return std::move(r);
+    template<typename GraphT>
+    bool is_adjustment(const GraphT& g, const NodeSet& X, const NodeSet& Y, const NodeSet& zset){
+        if((zset * adjustment_forbidden(g, X, Y)).size() != 0) return false;
+        return isDSep(proper_backdoor_graph(g, X, Y), X, Y, zset);
+    }
+
+    template<typename GraphT>
+    std::optional<NodeSet> adjustment_set(const GraphT& g, const NodeSet& X, const NodeSet& Y, const NodeSet& not_adj){
+        auto mark = std::vector<char>(g.nodes().bound(), 0);
+        for(const auto& n : X + Y){
+            mark[n] = 1;
+            _RCH_mark_(g, n, false, mark);
+        }
+        const auto excluded = adjustment_forbidden(g, X, Y) + Y + not_adj;
+        auto zset = NodeSet();
+        for(const auto& n : g.nodes()){
+            if(mark[n] && !excluded.contains(n)) zset.insert(n);
+        }
+        if(!isDSep(proper_backdoor_graph(g, X, Y), X, Y, zset)) return std::nullopt;
+        return zset;
     }
 
-    template<typename GUM_SCALAR> // TODO: giga tester ca
+    template<typename GUM_SCALAR>
     BackdoorIterable backdoor_generator(const BayesNet<GUM_SCALAR>& bn, NodeId cause, NodeId effect, const NodeSet& not_bd){
-        if(bn.parents(cause).size() == 0) return BackdoorIterable(); // empty
-        if(isParent(effect, cause, bn)) return BackdoorIterable(); // empty
+        auto constraints = BackdoorConstraints();
+        constraints.forbidden = not_bd;
+        return backdoor_generator(bn, cause, effect, constraints);
+    }
+
+    template<typename GUM_SCALAR>
+    std::optional<NodeSet> constrained_backdoor_set(const BayesNet<GUM_SCALAR>& bn, NodeId cause, NodeId effect, const BackdoorConstraints& constraints){
+        return _BD_constrained_set_(bn, cause, effect, constraints);
+    }
+
+    template<typename GraphT>
+    std::optional<NodeSet> _BD_constrained_set_(const GraphT& bn, NodeId cause, NodeId effect, const BackdoorConstraints& constraints){
+        const auto& required = constraints.required;
+        if(required.contains(cause) || required.contains(effect)) return std::nullopt;
+        if((required * constraints.forbidden).size() != 0) return std::nullopt;
+
+        auto desc = std::vector<char>(bn.nodes().bound(), 0);
+        _RCH_mark_(bn, cause, true, desc);
+        for(const auto& r : required)
+            if(desc[r]) return std::nullopt;
+
+        auto anc = std::vector<char>(bn.nodes().bound(), 0);
+        for(const auto& n : required + NodeSet({cause, effect})){
+            anc[n] = 1;
+            _RCH_mark_(bn, n, false, anc);
+        }
+        auto zset = NodeSet(required);
+        for(const auto& n : bn.nodes()){
+            if(!anc[n] || desc[n] || n == cause || n == effect) continue;
+            if(constraints.forbidden.contains(n)) continue;
+            if(!constraints.allowed.empty() && !constraints.allowed.contains(n)) continue;
+            zset.insert(n);
+        }
+        if(!isDSep_parents(bn, NodeSet({cause}), NodeSet({effect}), zset)) return std::nullopt;
+        return zset;
+    }
+
+    template<typename GraphT>
+    bool _BD_search_space_(const GraphT& bn, NodeId cause, NodeId effect, const BackdoorConstraints& constraints, 
+                           std::shared_ptr<DAG>& G, std::shared_ptr<NodeSet>& possible){
+        // a cause without parents has no backdoor path : its sets are checked 
+        // like the others, the required nodes alone being the minimal one
+        if(isParent(effect, cause, bn)) return false;
+        const auto& required = constraints.required;
+        if(required.size() > constraints.maxSize) return false;
+        // a single linear-time test rules out the unsatisfiable constraints (the allowed 
+        // nodes are only preferred)
+        auto hard = constraints;
+        hard.allowed.clear();
+        if(!_BD_constrained_set_(bn, cause, effect, hard)) return false;
 
         // simplify the graph
         auto interest = NodeSet({cause, effect});
-        auto G = std::make_shared<DAG>(dSep_reduce(bn, interest));
+        G = std::make_shared<DAG>(dSep_reduce(bn, interest + required));
+        auto desc = NodeSet();
+        {
+            auto mark = std::vector<char>(bn.nodes().bound(), 0);
+            _RCH_mark_(bn, cause, true, mark);
+            for(const auto& n : bn.nodes())
+                if(mark[n]) desc.insert(n);
+        }
 
         {
             // removing the non connected in G without descendants
             // GG is a trash graph just to find the disjointed nodes in G
             auto GG = DiGraph(*G);
-            for(const auto& i : descendants(bn, cause)) GG.eraseNode(i);
+            for(const auto& i : desc) GG.eraseNode(i);
 
             // we only keep interesting connex components
             for(const auto& [_, nodes] : GG.connectedComponents()){
@@ -131,40 +273,298 @@ namespace gum{
             }
         }
 
-        std::shared_ptr<NodeSet> possible = std::make_shared<NodeSet>();
-        *possible = G->nodes().asNodeSet() - (descendants(bn, cause) + interest + not_bd);
+        possible = std::make_shared<NodeSet>();
+        *possible = G->nodes().asNodeSet() - (desc + interest + constraints.forbidden + required);
+        return true;
+    }
+
+    template<typename GUM_SCALAR>
+    BackdoorIterable backdoor_generator(const BayesNet<GUM_SCALAR>& bn, NodeId cause, NodeId effect, const BackdoorConstraints& constraints){
+        const auto names = _DOOR_names_(bn);
+        return _BD_generator_(bn, cause, effect, constraints, canonical_fingerprint(bn, *names), names);
+    }
+
+    template<typename GraphT> // TODO: giga tester ca
+    BackdoorIterable _BD_generator_(const GraphT& bn, NodeId cause, NodeId effect, const BackdoorConstraints& constraints, uint64_t fingerprint, 
+                                    std::shared_ptr<const std::vector<std::string>> names){
+        std::shared_ptr<DAG> G;
+        std::shared_ptr<NodeSet> possible;
+        if(!_BD_search_space_(bn, cause, effect, constraints, G, possible)) return BackdoorIterable(); // empty
+        const auto& required = constraints.required;
+
+        // the selections start at one candidate : the required nodes alone (the empty set 
+        // when nothing is required) are tested first
+        if(isDSep_parents(*G, NodeSet({cause}), NodeSet({effect}), required)){
+            // the required nodes are enough : this is the only minimal set
+            auto begin = BackdoorIterator(G, std::make_shared<NodeSet>(), cause, effect, constraints);
+            begin._fingerprint_ = fingerprint;
+            begin._names_ = names;
+            begin._gen_cur_();
+            begin._add_door_();
+            return BackdoorIterable(std::move(begin), BackdoorIterator());
+        }
         if(possible->size() == 0) return BackdoorIterable();
 
-        return BackdoorIterable(BackdoorIterator(G, possible, cause, effect), BackdoorIterator());
+        // the allowed candidates first, if a set is made of them (linear-time test), then all of them
+        auto first = possible;
+        auto fallback = std::shared_ptr<NodeSet>();
+        if(!constraints.allowed.empty()){
+            auto preferred = std::make_shared<NodeSet>(*possible * constraints.allowed);
+            if(preferred->size() < possible->size() && _BD_constrained_set_(bn, cause, effect, constraints)){
+                first = preferred;
+                fallback = possible;
+            }
+        }
+
+        auto begin = BackdoorIterator(G, first, cause, effect, constraints);
+        begin._fingerprint_ = fingerprint;
+        begin._names_ = names;
+        begin._fallback_ = fallback;
+        ++begin; // positions the iterator on the first backdoor (or the end)
+        return BackdoorIterable(std::move(begin), BackdoorIterator());
     }
 
-    template<typename GUM_SCALAR> // TODO: giga tester ca
+    template<typename GraphT>
+    std::shared_ptr<const std::vector<NodeId>> _FD_seeds_(const GraphT& bn, NodeId cause, NodeId effect, NodeSet& possible){
+        auto seeds = std::make_shared<std::vector<NodeId>>();
+        for(const auto n : dipath_interceptors(bn, cause, effect)){
+            if(!possible.contains(n)) continue;
+            seeds->push_back(n);
+            possible.erase(n);
+        }
+        return seeds;
+    }
+
+    template<typename GUM_SCALAR>
     FrontdoorIterable<GUM_SCALAR> frontdoor_generator(const BayesNet<GUM_SCALAR>& bn, NodeId cause, NodeId effect, const NodeSet& not_fd){
-        if(isParent(cause, effect, bn)) return FrontdoorIterable(); // empty
-        auto possible = nodes_on_dipath(bn, cause, effect);
+        return frontdoor_generator(bn, cause, effect, BackdoorReachIndex(bn, NodeSet({cause})), not_fd);
+    }
+
+    template<typename GUM_SCALAR>
+    FrontdoorIterable<GUM_SCALAR> frontdoor_generator(const BayesNet<GUM_SCALAR>& bn, NodeId cause, NodeId effect, const BackdoorReachIndex& bdreach, const NodeSet& not_fd){
+        const auto names = _DOOR_names_(bn);
+        return _FD_generator_<GUM_SCALAR>(bn, cause, effect, bdreach, not_fd, canonical_fingerprint(bn, *names), names);
+    }
+
+    template<typename GUM_SCALAR, typename GraphT> // TODO: giga tester ca
+    FrontdoorIterable<GUM_SCALAR> _FD_generator_(const GraphT& bn, NodeId cause, NodeId effect, const BackdoorReachIndex& bdreach, 
+                                                 const NodeSet& not_fd, uint64_t fingerprint, std::shared_ptr<const std::vector<std::string>> names){
+        if(isParent(cause, effect, bn)) return FrontdoorIterable<GUM_SCALAR>(); // empty
         bool nodiPath = false;
-        if(possible){
+        std::shared_ptr<NodeSet> possible = _FD_candidates_(bn, cause, effect, bdreach, not_fd, nodiPath);
+
+        auto oracle = std::make_shared<const DipathOracle>(bn);
+        // a frontdoor set is made of candidates: none if they do not intercept all the paths together
+        if(!nodiPath && oracle->exists(cause, effect, *possible)) return FrontdoorIterable<GUM_SCALAR>(); // empty
+
+        // the single-node frontdoors are the dominators of the effect: they are 
+        // yielded first and left out of the subsets (which they would dominate)
+        auto seeds = nodiPath ? nullptr : _FD_seeds_(bn, cause, effect, *possible);
+        auto begin = FrontdoorIterator<GUM_SCALAR>(oracle, possible, cause, effect, nodiPath, seeds);
+        begin._fingerprint_ = fingerprint;
+        begin._names_ = names;
+        begin._excluded_ = not_fd;
+        ++begin; // positions the iterator on the first frontdoor (or the end)
+        return FrontdoorIterable<GUM_SCALAR>(std::move(begin), FrontdoorIterator<GUM_SCALAR>());
+    }
+
+    template<typename GraphT>
+    std::shared_ptr<NodeSet> _FD_candidates_(const GraphT& bn, NodeId cause, NodeId effect, const BackdoorReachIndex& bdreach, 
+                                             const NodeSet& not_fd, bool& nodiPath){
+        auto onPaths = _RCH_nodes_on_dipaths_(bn, cause, effect);
+        auto possible = onPaths ? std::make_shared<NodeSet>(std::move(*onPaths)) : nullptr;
+        nodiPath = false;
+        if(!possible){
             nodiPath = true;
-            possible = std::make_unique<NodeSet>();
+            possible = std::make_shared<NodeSet>();
             for(const auto& i : bn.nodes()) 
                 if(i != cause && i != effect) possible->insert(i);
         }
-        *possible -= backdoor_reach(bn, cause);
+        *possible -= bdreach.reach(cause);
         *possible -= not_fd;
         auto impossible = NodeSet();
         auto g = dSep_reduce(bn, Set({cause, effect}) + *possible);
         for(const auto& z : *possible){
-            if(!backdoor_path(g, Set({z}), Set({effect}), Set({cause}))) continue;
+            if(isDSep_parents(g, Set({z}), Set({effect}), Set({cause}))) continue;
+            impossible.insert(z);
+        }
+        *possible -= impossible;
+        return possible;
+    }
+
+    template<typename GUM_SCALAR>
+    std::optional<NodeSet> minimum_frontdoor_set(const BayesNet<GUM_SCALAR>& bn, NodeId cause, NodeId effect, 
+                                                 const HashTable<NodeId, double>& costs, const NodeSet& not_fd){
+        if(isParent(cause, effect, bn)) return std::nullopt;
+        const auto bdreach = BackdoorReachIndex(bn, NodeSet({cause}));
+        bool nodiPath = false;
+        auto possible = _FD_candidates_(bn, cause, effect, bdreach, not_fd, nodiPath);
+        auto cost = [&](NodeId n){ return costs.exists(n) ? costs[n] : 1.0; };
+
+        if(nodiPath){
+            // as in the generator, every candidate is a frontdoor on its own
+            auto best = std::optional<NodeSet>();
+            auto bestCost = 0.0;
+            for(const auto& z : *possible){
+                if(best && cost(z) >= bestCost) continue;
+                best = NodeSet({z});
+                bestCost = cost(z);
+            }
+            return best;
+        }
+
+        const auto oracle = DipathOracle(bn);
+        while(true){
+            const auto cut = min_vertex_cut(bn, cause, effect, *possible, costs);
+            if(!cut) return std::nullopt;
+
+            // the whole criterion on the cut
+            auto failing = *cut * bdreach.reach(cause);
+            const auto g = dSep_reduce(bn, *cut + Set({cause, effect}));
+            for(const auto& z : *cut)
+                if(!isDSep_parents(g, Set({z}), Set({effect}), Set({cause}))) failing.insert(z);
+            if(failing.empty() && !oracle.exists(cause, effect, *cut)) return cut;
+
+            // without a culprit, the whole cut is given up
+            *possible -= failing.empty() ? *cut : failing;
+        }
+    }
+
+    template<typename GUM_SCALAR>
+    FrontdoorIterable<GUM_SCALAR> conditional_frontdoor_generator(const BayesNet<GUM_SCALAR>& bn, NodeId cause, NodeId effect, const NodeSet& knowing, const NodeSet& not_fd){
+        const auto names = _DOOR_names_(bn);
+        return _FD_conditional_generator_<GUM_SCALAR>(bn, cause, effect, knowing, not_fd, canonical_fingerprint(bn, *names), names);
+    }
+
+    template<typename GUM_SCALAR, typename GraphT>
+    FrontdoorIterable<GUM_SCALAR> _FD_conditional_generator_(const GraphT& bn, NodeId cause, NodeId effect, const NodeSet& knowing, 
+                                                             const NodeSet& not_fd, uint64_t fingerprint, 
+                                                             std::shared_ptr<const std::vector<std::string>> names){
+        if(knowing.size() == 0) 
+            return _FD_generator_<GUM_SCALAR>(bn, cause, effect, BackdoorReachIndex(bn, NodeSet({cause})), not_fd, fingerprint, names);
+        if(isParent(cause, effect, bn)) return FrontdoorIterable<GUM_SCALAR>(); // empty
+        if(knowing.contains(cause) || knowing.contains(effect)) return FrontdoorIterable<GUM_SCALAR>(); // empty
+        {
+            auto desc = std::vector<char>(bn.nodes().bound(), 0);
+            _RCH_mark_(bn, cause, true, desc);
+            for(const auto& w : knowing)
+                if(desc[w]) return FrontdoorIterable<GUM_SCALAR>(); // empty
+        }
+
+        auto onPaths = _RCH_nodes_on_dipaths_(bn, cause, effect);
+        auto possible = onPaths ? std::make_shared<NodeSet>(std::move(*onPaths)) : nullptr;
+        bool nodiPath = false;
+        if(!possible){
+            nodiPath = true;
+            possible = std::make_shared<NodeSet>();
+            for(const auto& i : bn.nodes()) 
+                if(i != cause && i != effect) possible->insert(i);
+        }
+        *possible -= knowing;
+        *possible -= not_fd;
+
+        // both conditions are checked node by node: a backdoor path from the 
+        // set is a backdoor path from one of its nodes
+        auto impossible = NodeSet();
+        auto g = dSep_reduce(bn, Set({cause, effect}) + knowing + *possible);
+        for(const auto& z : *possible){
+            if(isDSep_parents(g, Set({cause}), Set({z}), knowing) 
+                && isDSep_parents(g, Set({z}), Set({effect}), knowing + Set({cause}))) continue;
             impossible.insert(z);
         }
         *possible -= impossible;
 
-        return FrontdoorIterable(FrontdoorIterator(bn, *possible, cause, effect, nodiPath), FrontdoorIterator());
+        auto oracle = std::make_shared<const DipathOracle>(bn);
+        if(!nodiPath && oracle->exists(cause, effect, *possible)) return FrontdoorIterable<GUM_SCALAR>(); // empty
+
+        // the single-node frontdoors are the dominators of the effect: they are 
+        // yielded first and left out of the subsets (which they would dominate)
+        auto seeds = nodiPath ? nullptr : _FD_seeds_(bn, cause, effect, *possible);
+        auto begin = FrontdoorIterator<GUM_SCALAR>(oracle, possible, cause, effect, nodiPath, seeds);
+        begin._fingerprint_ = fingerprint;
+        begin._names_ = names;
+        begin._excluded_ = not_fd;
+        ++begin; // positions the iterator on the first frontdoor (or the end)
+        return FrontdoorIterable<GUM_SCALAR>(std::move(begin), FrontdoorIterator<GUM_SCALAR>());
+    }
+
+    template<typename GraphT>
+    AdjustmentIterable adjustment_generator(const GraphT& g, const NodeSet& causes, const NodeSet& effects, const NodeSet& not_adj){
+        if(causes.empty() || effects.empty()) GUM_ERROR(InvalidArgument, "an adjustment set needs at least one cause and one effect")
+        // existence test first: it also gives the candidates, every minimal 
+        // adjustment set being a subset of the ancestors of causes + effects
+        const auto zmax = adjustment_set(g, causes, effects, not_adj);
+        if(!zmax) return AdjustmentIterable(); // empty
+
+        auto G = std::make_shared<DAG>(proper_backdoor_graph(g, causes, effects));
+        auto X = std::make_shared<const NodeSet>(causes);
+        auto Y = std::make_shared<const NodeSet>(effects);
+        if(isDSep(*G, causes, effects, NodeSet())){
+            // the empty set is the only minimal adjustment set
+            auto begin = AdjustmentIterator(G, std::make_shared<NodeSet>(), X, Y);
+            begin._doors_.insert(NodeSet());
+            return AdjustmentIterable(std::move(begin), AdjustmentIterator());
+        }
+
+        auto begin = AdjustmentIterator(G, std::make_shared<NodeSet>(*zmax), X, Y);
+        begin._excluded_ = not_adj;
+        ++begin; // positions the iterator on the first adjustment set
+        return AdjustmentIterable(std::move(begin), AdjustmentIterator());
+    }
+
+    template<typename GUM_SCALAR>
+    std::shared_ptr<const std::vector<std::string>> _DOOR_names_(const BayesNet<GUM_SCALAR>& bn){
+        auto names = std::make_shared<std::vector<std::string>>(bn.nodes().bound());
+        for(const auto& n : bn.nodes()) (*names)[n] = bn.variable(n).name();
+        return names;
+    }
+
+    template<typename GUM_SCALAR>
+    DoorCursor _DOOR_parse_(const BayesNet<GUM_SCALAR>& bn, const std::vector<uint8_t>& cursor){
+        const auto cur = DoorCursor::parse(cursor);
+        if(cur.names.empty()){
+            // an unnamed cursor (or one of version 3 at most) is checked on the node ids
+            if(cur.fingerprint != structural_fingerprint(bn)) 
+                throw std::invalid_argument("Stale cursor: the model changed since the enumeration was checkpointed.");
+            return cur;
+        }
+        if(cur.fingerprint != canonical_fingerprint(bn, *_DOOR_names_(bn))) 
+            throw std::invalid_argument("Stale cursor: the model changed since the enumeration was checkpointed.");
+        // same structure on the same names : every name of the cursor is a node of bn
+        auto ids = HashTable<NodeId, NodeId>();
+        for(const auto& [n, name] : cur.names) ids.insert(n, bn.idFromName(name));
+        return cur.relabel(ids);
+    }
+
+    template<typename GUM_SCALAR>
+    BackdoorIterable backdoor_generator_resume(const BayesNet<GUM_SCALAR>& bn, const std::vector<uint8_t>& cursor){
+        const auto cur = _DOOR_parse_(bn, cursor);
+        if(cur.is_front_door) 
+            throw std::invalid_argument("The cursor was produced by a frontdoor enumeration.");
+
+        auto begin = backdoor_generator(bn, cur.cause, cur.effect, cur.constraints).begin();
+        // checkpointed after the preferred candidates
+        if(begin._fallback_ != nullptr && cur.possible.size() == begin._fallback_->size()) begin._useFallback_();
+        begin._restore_(cur);
+        return BackdoorIterable(std::move(begin), BackdoorIterator());
+    }
+
+    template<typename GUM_SCALAR>
+    FrontdoorIterable<GUM_SCALAR> frontdoor_generator_resume(const BayesNet<GUM_SCALAR>& bn, const std::vector<uint8_t>& cursor){
+        const auto cur = _DOOR_parse_(bn, cursor);
+        if(!cur.is_front_door) 
+            throw std::invalid_argument("The cursor was produced by a backdoor enumeration.");
+
+        auto begin = frontdoor_generator(bn, cur.cause, cur.effect, cur.excluded).begin();
+        begin._restore_(cur);
+        begin._restore_seeds_(cur);
+        return FrontdoorIterable<GUM_SCALAR>(std::move(begin), FrontdoorIterator<GUM_SCALAR>());
     }
 
     template<typename GUM_SCALAR>
     FrontdoorIterator<GUM_SCALAR>::FrontdoorIterator
-        (const std::shared_ptr<BayesNet<GUM_SCALAR>> bn, const std::shared_ptr<NodeSet> possible, NodeId cause, NodeId effect, bool nodiPath)
+        (const std::shared_ptr<const DipathOracle> oracle, const std::shared_ptr<NodeSet> possible, NodeId cause, NodeId effect, bool nodiPath,
+         const std::shared_ptr<const std::vector<NodeId>> seeds)
         : DoorIterator(
             false, 
             true,
@@ -176,27 +576,30 @@ namespace gum{
             std::vector<bool>(possible->size(), false), 
             0,
             NodeSet({})), 
-            _bn_(bn),
-            _nodiPath_(nodiPath)
+            _oracle_(oracle),
+            _nodiPath_(nodiPath),
+            _seeds_(seeds),
+            _seedPos_(0)
 
     {
         GUM_CONSTRUCTOR(FrontdoorIterator)
     }
     template<typename GUM_SCALAR>
     FrontdoorIterator<GUM_SCALAR>::FrontdoorIterator()
-        : DoorIterator(true), _bn_(nullptr), _nodiPath_(false)
+        : DoorIterator(true), _oracle_(nullptr), _nodiPath_(false), _seeds_(nullptr), _seedPos_(0)
     {    
         GUM_CONSTRUCTOR(FrontdoorIterator)
     }
     template<typename GUM_SCALAR>
     FrontdoorIterator<GUM_SCALAR>::FrontdoorIterator(FrontdoorIterator<GUM_SCALAR>&& v)
-        : DoorIterator(v),  _bn_(std::move(v._bn_)), _nodiPath_(std::exchange(v._nodiPath_, false))
+        : DoorIterator(v),  _oracle_(std::move(v._oracle_)), _nodiPath_(std::exchange(v._nodiPath_, false)),
+          _seeds_(std::move(v._seeds_)), _seedPos_(std::exchange(v._seedPos_, 0))
     {
         GUM_CONS_MOV(FrontdoorIterator)
     }
     template<typename GUM_SCALAR>
     FrontdoorIterator<GUM_SCALAR>::FrontdoorIterator(const FrontdoorIterator<GUM_SCALAR>& v)
-        : DoorIterator(v),  _bn_(v._bn_), _nodiPath_(v._nodiPath_)
+        : DoorIterator(v),  _oracle_(v._oracle_), _nodiPath_(v._nodiPath_), _seeds_(v._seeds_), _seedPos_(v._seedPos_)
     {
         GUM_CONS_CPY(FrontdoorIterator)
     }
@@ -207,16 +610,20 @@ namespace gum{
     template<typename GUM_SCALAR>
     FrontdoorIterator<GUM_SCALAR>& FrontdoorIterator<GUM_SCALAR>::operator=(FrontdoorIterator<GUM_SCALAR>&& v){
         DoorIterator::operator=(v);
-        _bn_ = std::move(v._bn_);
+        _oracle_ = std::move(v._oracle_);
         _nodiPath_ = std::exchange(v._nodiPath_, false);
+        _seeds_ = std::move(v._seeds_);
+        _seedPos_ = std::exchange(v._seedPos_, 0);
         GUM_OP_MOV(FrontdoorIterator)
         return *this;
     }
     template<typename GUM_SCALAR>
     FrontdoorIterator<GUM_SCALAR>& FrontdoorIterator<GUM_SCALAR>::operator=(const FrontdoorIterator<GUM_SCALAR>& v){
         DoorIterator::operator=(v);
-        _bn_ = v._bn_;
+        _oracle_ = v._oracle_;
         _nodiPath_ = v._nodiPath_;
+        _seeds_ = v._seeds_;
+        _seedPos_ = v._seedPos_;
         GUM_OP_CPY(FrontdoorIterator)
         return *this;
     }
@@ -237,23 +644,59 @@ namespace gum{
 
     template<typename GUM_SCALAR>
     bool FrontdoorIterator<GUM_SCALAR>::_next_(){
+        // the single candidates and the seeds are kept in _doors_ for the checkpoints only (no 
+        // subset of possible contains a seed) : those found before a checkpoint are skipped
         if(_nodiPath_){
-            if(_selection_size_ >= _possible_->size()) return false;
-            _cur_ = Set({(*_possible_)[_selection_size_++]});
-            return true;
-        }
-        if(!_advance_selection_mask_()) return false; 
-        _gen_cur_();
-        bool worth_testing = true;
-        for(auto& s : _doors_){
-            if(s.isSubsetOrEqual(_cur_)) worth_testing = false;
+            while(_selection_size_ < _possible_->size()){
+                _cur_ = Set({(*_possible_)[_selection_size_++]});
+                if(_doors_.contains(_cur_)) continue;
+                _doors_.insert(_cur_);
+                return true;
+            }
+            return false;
         }
-        if(worth_testing && !exists_unblocked_directed_path(_bn_, _cause_, _effect_, _cur_)){
+        while(_seeds_ != nullptr && _seedPos_ < _seeds_->size()){
+            _cur_ = Set({(*_seeds_)[_seedPos_++]});
+            if(_doors_.contains(_cur_)) continue;
             _doors_.insert(_cur_);
             return true;
-        }else{
-            return _next_(); // skip this as this is an invalid set
         }
+        while(_advance_selection_mask_()){
+            // a single node of possible intercepts every directed path only if it 
+            // dominates the effect, and the dominators were all seeded
+            if(_seeds_ != nullptr && _selection_size_ == 1) continue;
+            _gen_cur_();
+            if(_dominated_() || _oracle_->exists(_cause_, _effect_, _cur_)) continue; // invalid set
+            _add_door_();
+            return true;
+        }
+        return false;
+    }
+
+    template<typename GUM_SCALAR>
+    void FrontdoorIterator<GUM_SCALAR>::_restore_seeds_(const DoorCursor& cursor){
+        if(_is_the_end_) return;
+        if(!cursor.current.empty() && (_nodiPath_ || (_seeds_ != nullptr && _selection_size_ == 0))){
+            // the single-node doors are yielded again from the first one, those already found 
+            // being skipped : this holds whatever their order in the rebuilt model
+            if(_nodiPath_) _selection_size_ = 0;
+            else _seedPos_ = 0;
+            _cur_ = cursor.current;
+            return;
+        }
+        if(_nodiPath_){
+            // the candidates are yielded one by one, _selection_size_ of them so far
+            if(_selection_size_ > 0) _cur_ = Set({(*_possible_)[_selection_size_ - 1]});
+            return;
+        }
+        if(_seeds_ == nullptr) return;
+        if(_selection_size_ > 0){
+            _seedPos_ = _seeds_->size();
+            return;
+        }
+        // still yielding the seeds: every door found so far is one of them
+        _seedPos_ = std::min(_doors_.size(), _seeds_->size());
+        if(_seedPos_ > 0) _cur_ = Set({(*_seeds_)[_seedPos_ - 1]});
     }
 
 }
\ No newline at end of file
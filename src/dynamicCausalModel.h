@@ -0,0 +1,196 @@
+#ifndef GUM_DYNAMIC_CAUSAL_MODEL_H
+#define GUM_DYNAMIC_CAUSAL_MODEL_H
+
+#include <agrum/BN/BayesNet.h>
+#include <agrum/BN/BayesNetFragment.h>
+#include <agrum/tools/core/set.h>
+#include <agrum/tools/core/hashTable.h>
+#include <agrum/tools/multidim/potential.h>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "CausalModel.h"
+#include "causalQueryCache.h"
+#include "doAST.h"
+#include "doCalculus.h"
+#include "dSeparation.h"
+
+namespace gum{
+
+    /**
+     * @class DynamicCausalModel
+     * @brief Causal model of a process over time, given by a 2-slice
+     * template and unrolled on demand.
+     *
+     * The template is a Bayesian network following the 2TBN naming : the
+     * variable ``X0`` is X in the first slice and ``Xt`` is X in a slice t > 0,
+     * a parent ``Y0`` of ``Xt`` standing for Y in the slice t-1. Every variable
+     * has both forms. The latent variables of the template are described over
+     * these names : the ones over ``0`` variables only confound the first
+     * slice, the others are repeated in every slice t > 0 (``U`` becoming
+     * ``U0`` in the first slice, ``U1``, ``U2``... in the others). The
+     * variable X of the slice t is named ``Xt`` with t written in decimal
+     * (``X0``, ``X1``...).
+     *
+     * The slices are unrolled once, when a query first needs them, into a
+     * single network and causal model that grow in place : an extension adds
+     * the new slices without touching the former ones, their tables being
+     * filled from the template with the variable mapping computed once. The
+     * identifications and the d-separations are cached with their dependency
+     * footprint (see @ref CausalQueryCache), and a query only works on the
+     * ancestors of its variables, not on the whole unrolled graph. No arc of
+     * the template goes back in time, but a repeated latent variable with
+     * ``0`` children gives, in the slice t, a parent to these variables of the
+     * slice t-1 (and erases the arcs between its children if they are not
+     * kept) : an extension then invalidates the results whose footprint holds
+     * them, identified again on the extended model. The other results on the
+     * former slices are still served.
+     *
+     * An effect between slices t > h (h the history of the model) is first
+     * identified on a window : the slices from t-h on, the first one standing
+     * for the history it cuts (its variables all connected and confounded).
+     * The window only depends on the template, so its formula is shared by
+     * all the shifts of the query and re-indexed on their slices ; the query
+     * is identified on the whole model only if the window hides the effect.
+     *
+     * @warning the template must outlive the model
+     */
+    template<typename GUM_SCALAR>
+    class DynamicCausalModel {
+    private:
+        const BayesNet<GUM_SCALAR>& _template_;
+        std::vector<std::pair<std::string, std::vector<std::string>>> _latents_; ///< the template latent variables
+        bool _keepArcs_;
+        Set<std::string> _bases_;          ///< the names of the variables, without the slice
+        std::vector<NodeId> _initial_;     ///< the ``0`` variables of the template, in topological order
+        std::vector<NodeId> _transition_;  ///< the ``t`` variables of the template, in topological order
+        BayesNet<GUM_SCALAR> _bn_;         ///< the unrolled network
+        std::unique_ptr<CausalModel<GUM_SCALAR>> _cm_; ///< the unrolled causal model, over _bn_
+        std::vector<HashTable<std::string, NodeId>> _slices_; ///< the node of each variable in each slice
+        CausalQueryCache<GUM_SCALAR, std::shared_ptr<const ASTtree<GUM_SCALAR>>> _identified_;
+        CausalQueryCache<GUM_SCALAR, bool> _separated_;
+        Size _history_; ///< the slices kept before a query identified on a window
+
+        /// the model of a window of slices
+        struct _Window_ {
+            BayesNet<GUM_SCALAR> bn;
+            std::unique_ptr<CausalModel<GUM_SCALAR>> cm; ///< over bn
+        };
+        std::unordered_map<Size, std::unique_ptr<_Window_>> _windows_; ///< by number of slices after the first one
+        /// the formulas identified on a window, by query over the names of the window (nullptr if it hides the effect)
+        HashTable<std::string, std::shared_ptr<const ASTtree<GUM_SCALAR>>> _windowed_;
+
+        /// the name of the variable of the template without its slice
+        static std::string _base_(const std::string& name);
+
+        /// the variable and the slice of a name of the unrolled model
+        std::pair<std::string, Size> _split_(const std::string& name) const;
+
+        /// the name ``name`` of the slice t moved to the slice t - from + to
+        std::string _shifted_(const std::string& name, Size from, Size to) const;
+
+        /// the window of ``width`` slices after its first one, built at the first call
+        const _Window_& _window_(Size width);
+
+        /// the formula identifying the effect on a window, nullptr if the query reaches the slice 0 or the window hides the effect
+        std::shared_ptr<const ASTtree<GUM_SCALAR>> _identifyOnWindow_(const NameSet& on, const NameSet& doing);
+
+        /// the node of the template variable ``name`` seen from the slice ``t``
+        NodeId _node_(const std::string& name, Size t) const;
+
+        /// unrolls the slice ``t``, in O(size of the slice)
+        void _unroll_(Size t);
+
+        /// the nodes of a set of names of the unrolled model, unrolling the slices they need
+        NodeSet _ids_(const NameSet& names);
+
+        /// the key of a query in the caches
+        static std::string _key_(const std::vector<const NameSet*>& sets);
+
+    public:
+        /**
+         * @brief Builds the model with its first slice
+         *
+         * @param tmpl the 2-slice template
+         * @param latentVarDescriptors the latent variables of the template
+         * (see @ref CausalModel), over the names of the template
+         * @param keepArcs whether the arcs between the children of a latent
+         * variable are kept
+         * @param history the slices kept before a query identified on a window (1 at least)
+         * @throw InvalidArgument if the template does not follow the 2TBN naming,
+         * has an arc from a ``t`` variable to a ``0`` one, or has a latent variable
+         * ending with a digit or named as another variable, or if ``history`` is 0
+         */
+        DynamicCausalModel(const BayesNet<GUM_SCALAR>& tmpl,
+                           const std::vector<std::pair<std::string, std::vector<std::string>>>& latentVarDescriptors = {},
+                           bool keepArcs = false,
+                           Size history = 1);
+        DynamicCausalModel(const DynamicCausalModel<GUM_SCALAR>&) = delete;
+        DynamicCausalModel<GUM_SCALAR>& operator=(const DynamicCausalModel<GUM_SCALAR>&) = delete;
+        ~DynamicCausalModel();
+
+        /// the 2-slice template
+        const BayesNet<GUM_SCALAR>& templateBN() const;
+
+        /// the last unrolled slice
+        Size horizon() const;
+
+        /// unrolls the slices up to ``T`` (nothing if they already are), in O(size of the new slices)
+        void extendTo(Size T);
+
+        /// the name of the variable ``base`` in the slice ``t``
+        static std::string name(const std::string& base, Size t);
+
+        /**
+         * @return Size the slice of the variable ``name`` of the unrolled model
+         * @throw NotFound if ``name`` is not of the form <variable><slice>
+         */
+        Size slice(const std::string& name) const;
+
+        /**
+         * @param base a variable of the template, without its slice
+         * @param t a slice, unrolled if needed
+         * @return NodeId the node of ``base`` in the slice ``t``
+         */
+        NodeId idFromName(const std::string& base, Size t);
+
+        /// the unrolled network, up to the horizon
+        const BayesNet<GUM_SCALAR>& unrolledBN() const;
+
+        /// the unrolled causal model, up to the horizon
+        const CausalModel<GUM_SCALAR>& model() const;
+
+        /// the causal model unrolled up to ``T`` at least
+        const CausalModel<GUM_SCALAR>& model(Size T);
+
+        /**
+         * @brief Returns the formula identifying the effect of ``doing`` on
+         * ``on`` (names of the unrolled model), the slices they need being
+         * unrolled first. The formula of a window is served if it identifies
+         * the effect (see @ref DynamicCausalModel).
+         *
+         * @throw HedgeException if the effect is not identifiable
+         */
+        std::shared_ptr<const ASTtree<GUM_SCALAR>> identify(const NameSet& on, const NameSet& doing);
+
+        /**
+         * @brief Returns the distribution of ``on`` under the intervention on
+         * ``doing`` (see @ref identify), evaluated on the sub-network of the
+         * ancestors of the variables of the formula
+         */
+        Potential<GUM_SCALAR> causalImpact(const NameSet& on, const NameSet& doing);
+
+        /**
+         * @brief Whether ``zset`` d-separates ``x`` and ``y`` in the unrolled
+         * causal model (names of the unrolled model)
+         */
+        bool isDSep(const NameSet& x, const NameSet& y, const NameSet& zset);
+    };
+}
+
+#include "dynamicCausalModel_tpl.h"
+
+#endif
@@ -0,0 +1,323 @@
+#include "dynamicCausalModel.h"
+
+#include <algorithm>
+#include <cctype>
+#include <limits>
+
+namespace gum{
+
+    template<typename GUM_SCALAR>
+    DynamicCausalModel<GUM_SCALAR>::DynamicCausalModel(
+        const BayesNet<GUM_SCALAR>& tmpl,
+        const std::vector<std::pair<std::string, std::vector<std::string>>>& latentVarDescriptors,
+        bool keepArcs,
+        Size history)
+        : _template_(tmpl), _latents_(latentVarDescriptors), _keepArcs_(keepArcs), _bases_(), _initial_(),
+          _transition_(), _bn_(), _cm_(std::make_unique<CausalModel<GUM_SCALAR>>(_bn_)), _slices_(),
+          _identified_(*_cm_), _separated_(*_cm_), _history_(history), _windows_(), _windowed_()
+    {
+        if(history == 0) GUM_ERROR(InvalidArgument, "a window keeps one slice of history at least")
+        auto names = Set<std::string>();
+        for(const auto& n : tmpl.nodes()){
+            const auto& nm = tmpl.variable(n).name();
+            if(nm.size() < 2 || (nm.back() != '0' && nm.back() != 't') || std::isdigit((unsigned char)nm[nm.size() - 2]))
+                GUM_ERROR(InvalidArgument, "the template variable " << nm << " is not named <variable>0 or <variable>t")
+            names.insert(nm);
+            _bases_.insert(_base_(nm));
+        }
+        for(const auto& b : _bases_)
+            if(!names.contains(b + "0") || !names.contains(b + "t"))
+                GUM_ERROR(InvalidArgument, "the template variable " << b << " needs both a 0 and a t form")
+        for(const auto& a : tmpl.arcs())
+            if(tmpl.variable(a.tail()).name().back() == 't' && tmpl.variable(a.head()).name().back() == '0')
+                GUM_ERROR(InvalidArgument, "the template arc " << tmpl.variable(a.tail()).name() << "->"
+                          << tmpl.variable(a.head()).name() << " goes back in time")
+        auto latents = Set<std::string>();
+        for(const auto& l : latentVarDescriptors){
+            // ``U`` is unrolled as ``U0``, ``U1``... : it must not end with a digit nor be a variable
+            if(l.first.empty() || std::isdigit((unsigned char)l.first.back()))
+                GUM_ERROR(InvalidArgument, "the latent variable " << l.first << " is not named <variable>")
+            if(_bases_.contains(l.first) || latents.contains(l.first))
+                GUM_ERROR(InvalidArgument, "the latent variable " << l.first << " is already a variable of the model")
+            latents.insert(l.first);
+            for(const auto& c : l.second)
+                if(!names.contains(c)) GUM_ERROR(InvalidArgument, "the latent variable " << l.first << " has an unknown child " << c)
+        }
+
+        for(const auto& n : tmpl.topologicalOrder())
+            (tmpl.variable(n).name().back() == '0' ? _initial_ : _transition_).push_back(n);
+        extendTo(0);
+        GUM_CONSTRUCTOR(DynamicCausalModel)
+    }
+
+    template<typename GUM_SCALAR>
+    DynamicCausalModel<GUM_SCALAR>::~DynamicCausalModel(){
+        GUM_DESTRUCTOR(DynamicCausalModel)
+    }
+
+    template<typename GUM_SCALAR>
+    std::string DynamicCausalModel<GUM_SCALAR>::_base_(const std::string& name){
+        return name.substr(0, name.size() - 1);
+    }
+
+    template<typename GUM_SCALAR>
+    std::pair<std::string, Size> DynamicCausalModel<GUM_SCALAR>::_split_(const std::string& name) const {
+        auto pos = name.size();
+        while(pos > 0 && std::isdigit((unsigned char)name[pos - 1])) pos--;
+        if(pos == 0 || pos == name.size() || !_bases_.contains(name.substr(0, pos)))
+            GUM_ERROR(NotFound, name << " is not a variable of the unrolled model")
+        return std::make_pair(name.substr(0, pos), Size(std::stoull(name.substr(pos))));
+    }
+
+    template<typename GUM_SCALAR>
+    std::string DynamicCausalModel<GUM_SCALAR>::_shifted_(const std::string& name, Size from, Size to) const {
+        const auto [base, t] = _split_(name);
+        return DynamicCausalModel<GUM_SCALAR>::name(base, t - from + to);
+    }
+
+    template<typename GUM_SCALAR>
+    const typename DynamicCausalModel<GUM_SCALAR>::_Window_& DynamicCausalModel<GUM_SCALAR>::_window_(Size width){
+        auto& window = _windows_[width];
+        if(window != nullptr) return *window;
+        window = std::make_unique<_Window_>();
+        auto& bn = window->bn;
+
+        auto slices = std::vector<HashTable<std::string, NodeId>>(width + 1);
+        for(Size r = 0; r <= width; r++)
+            for(const auto& n : _transition_){
+                const auto base = _base_(_template_.variable(n).name());
+                auto var = std::unique_ptr<DiscreteVariable>(_template_.variable(n).clone());
+                var->setName(name(base, r));
+                slices[r].insert(base, bn.add(*var));
+            }
+        // the first slice stands for the history it cuts, which may connect any of its variables :
+        // they are all connected (in the order of the template), the later slices follow the template
+        for(std::size_t i = 0; i < _transition_.size(); i++)
+            for(std::size_t j = i + 1; j < _transition_.size(); j++)
+                bn.addArc(slices[0][_base_(_template_.variable(_transition_[i]).name())],
+                          slices[0][_base_(_template_.variable(_transition_[j]).name())]);
+        const auto node = [&](const std::string& nm, Size r){
+            return slices[nm.back() == 't' ? r : r - 1][_base_(nm)];
+        };
+        for(Size r = 1; r <= width; r++)
+            for(const auto& n : _transition_)
+                for(const auto& p : _template_.parents(n))
+                    bn.addArc(node(_template_.variable(p).name(), r), node(_template_.variable(n).name(), r));
+
+        // the history also confounds all the variables of the first slice (the arcs above are
+        // kept : more arcs and confounders than the unrolled model only make the window stricter)
+        window->cm = std::make_unique<CausalModel<GUM_SCALAR>>(bn);
+        auto boundary = std::vector<NodeId>();
+        for(const auto& n : _transition_) boundary.push_back(slices[0][_base_(_template_.variable(n).name())]);
+        if(boundary.size() > 1) window->cm->addLatentVariable("history", boundary, true); // no other name without a slice
+        for(Size r = 1; r <= width; r++)
+            for(const auto& l : _latents_){
+                if(std::all_of(l.second.begin(), l.second.end(), [](const std::string& c){ return c.back() == '0'; })) continue;
+                auto children = std::vector<NodeId>();
+                for(const auto& c : l.second) children.push_back(node(c, r));
+                window->cm->addLatentVariable(name(l.first, r), children, _keepArcs_);
+            }
+        return *window;
+    }
+
+    template<typename GUM_SCALAR>
+    std::shared_ptr<const ASTtree<GUM_SCALAR>> DynamicCausalModel<GUM_SCALAR>::_identifyOnWindow_(const NameSet& on, const NameSet& doing){
+        auto first = std::numeric_limits<Size>::max();
+        Size last = 0;
+        for(const auto* s : {&on, &doing})
+            for(const auto& n : *s){
+                const auto t = _split_(n).second;
+                first = std::min(first, t);
+                last = std::max(last, t);
+            }
+        // the slice 0 has its own template : such a query is only identified on the whole model
+        if(first <= _history_) return nullptr;
+
+        // the query over the names of the window, whose first slice is the slice ``shift``
+        const auto shift = first - _history_;
+        const auto relative = [&](const NameSet& names){
+            auto res = NameSet();
+            for(const auto& n : names) res.insert(_shifted_(n, shift, 0));
+            return res;
+        };
+        const auto relOn = relative(on);
+        const auto relDoing = relative(doing);
+        const auto key = _key_({&relOn, &relDoing});
+        if(!_windowed_.exists(key)){
+            auto formula = std::shared_ptr<const ASTtree<GUM_SCALAR>>();
+            try{
+                formula = identifyingIntervention(*_window_(last - shift).cm, relOn, relDoing, nullptr);
+            }catch(const HedgeException&){ // the confounding of the history may hide an identification of the whole model
+            }catch(const UnidentifiableException&){}
+            _windowed_.insert(key, formula);
+        }
+
+        const auto& formula = _windowed_[key];
+        if(formula == nullptr) return nullptr;
+        return renamedTree(*formula, [&](const std::string& n){ return _shifted_(n, 0, shift); });
+    }
+
+    template<typename GUM_SCALAR>
+    NodeId DynamicCausalModel<GUM_SCALAR>::_node_(const std::string& name, Size t) const {
+        const auto base = _base_(name);
+        if(name.back() == 't' || t == 0) return _slices_[t][base];
+        return _slices_[t - 1][base];
+    }
+
+    template<typename GUM_SCALAR>
+    void DynamicCausalModel<GUM_SCALAR>::_unroll_(Size t){
+        const auto& vars = t == 0 ? _initial_ : _transition_;
+        // ids free in the network and in the causal model (whose latent ids are not in the network)
+        auto next = std::max(_bn_.nodes().bound(), _cm_->dag().bound());
+        _slices_.push_back(HashTable<std::string, NodeId>());
+
+        // no topology transformation : its end rebuilds every table of the network, while an arc
+        // only extends the table of its (new) child
+        for(const auto& n : vars){
+            const auto base = _base_(_template_.variable(n).name());
+            auto var = std::unique_ptr<DiscreteVariable>(_template_.variable(n).clone());
+            var->setName(name(base, t));
+            _bn_.add(*var, next);
+            _slices_[t].insert(base, next);
+            next++;
+        }
+        for(const auto& n : vars){
+            const auto child = _node_(_template_.variable(n).name(), t);
+            for(const auto& p : _template_.parents(n))
+                _bn_.addArc(_node_(_template_.variable(p).name(), t), child);
+        }
+
+        // the tables of the template, a variable of the slice t being its ``t`` form
+        for(const auto& n : vars){
+            const auto& cpt = _bn_.cpt(_node_(_template_.variable(n).name(), t));
+            auto mapSrc = std::vector<std::string>();
+            for(const auto v : cpt.variablesSequence()){
+                const auto s = slice(v->name());
+                const auto base = v->name().substr(0, v->name().size() - std::to_string(s).size());
+                mapSrc.push_back(base + (t > 0 && s == t ? "t" : "0"));
+            }
+            cpt.fillWith(_template_.cpt(n), mapSrc);
+        }
+
+        for(const auto& n : vars) _cm_->addObservedVariable(_node_(_template_.variable(n).name(), t));
+        for(const auto& l : _latents_){
+            const bool initial = std::all_of(l.second.begin(), l.second.end(),
+                                             [](const std::string& c){ return c.back() == '0'; });
+            if(initial != (t == 0)) continue;
+            auto children = std::vector<NodeId>();
+            for(const auto& c : l.second) children.push_back(_node_(c, t));
+            _cm_->addLatentVariable(name(l.first, t), children, _keepArcs_);
+        }
+    }
+
+    template<typename GUM_SCALAR>
+    NodeSet DynamicCausalModel<GUM_SCALAR>::_ids_(const NameSet& names){
+        Size last = 0;
+        for(const auto& n : names) last = std::max(last, slice(n));
+        extendTo(last);
+        auto res = NodeSet();
+        for(const auto& n : names) res.insert(_cm_->idFromName(n));
+        return res;
+    }
+
+    template<typename GUM_SCALAR>
+    std::string DynamicCausalModel<GUM_SCALAR>::_key_(const std::vector<const NameSet*>& sets){
+        auto res = std::string();
+        for(const auto* s : sets){
+            auto sorted = std::vector<std::string>(s->begin(), s->end());
+            std::sort(sorted.begin(), sorted.end());
+            for(const auto& n : sorted) res += n + ",";
+            res += "|";
+        }
+        return res;
+    }
+
+    template<typename GUM_SCALAR>
+    const BayesNet<GUM_SCALAR>& DynamicCausalModel<GUM_SCALAR>::templateBN() const {
+        return _template_;
+    }
+
+    template<typename GUM_SCALAR>
+    Size DynamicCausalModel<GUM_SCALAR>::horizon() const {
+        return _slices_.size() - 1;
+    }
+
+    template<typename GUM_SCALAR>
+    void DynamicCausalModel<GUM_SCALAR>::extendTo(Size T){
+        if(_slices_.size() > T) return;
+        while(_slices_.size() <= T) _unroll_(_slices_.size());
+        _cm_->freezeSymbols(); // once for all the new slices
+    }
+
+    template<typename GUM_SCALAR>
+    std::string DynamicCausalModel<GUM_SCALAR>::name(const std::string& base, Size t){
+        return base + std::to_string(t);
+    }
+
+    template<typename GUM_SCALAR>
+    Size DynamicCausalModel<GUM_SCALAR>::slice(const std::string& name) const {
+        return _split_(name).second;
+    }
+
+    template<typename GUM_SCALAR>
+    NodeId DynamicCausalModel<GUM_SCALAR>::idFromName(const std::string& base, Size t){
+        if(!_bases_.contains(base)) GUM_ERROR(NotFound, base << " is not a variable of the template")
+        extendTo(t);
+        return _slices_[t][base];
+    }
+
+    template<typename GUM_SCALAR>
+    const BayesNet<GUM_SCALAR>& DynamicCausalModel<GUM_SCALAR>::unrolledBN() const {
+        return _bn_;
+    }
+
+    template<typename GUM_SCALAR>
+    const CausalModel<GUM_SCALAR>& DynamicCausalModel<GUM_SCALAR>::model() const {
+        return *_cm_;
+    }
+
+    template<typename GUM_SCALAR>
+    const CausalModel<GUM_SCALAR>& DynamicCausalModel<GUM_SCALAR>::model(Size T){
+        extendTo(T);
+        return *_cm_;
+    }
+
+    template<typename GUM_SCALAR>
+    std::shared_ptr<const ASTtree<GUM_SCALAR>> DynamicCausalModel<GUM_SCALAR>::identify(const NameSet& on, const NameSet& doing){
+        const auto seeds = _ids_(on) + _ids_(doing);
+        return _identified_.get("do" + _key_({&on, &doing}), seeds, [&](){
+            if(auto formula = _identifyOnWindow_(on, doing); formula != nullptr) return formula;
+            return std::shared_ptr<const ASTtree<GUM_SCALAR>>(identifyingIntervention(*_cm_, on, doing, nullptr));
+        });
+    }
+
+    template<typename GUM_SCALAR>
+    Potential<GUM_SCALAR> DynamicCausalModel<GUM_SCALAR>::causalImpact(const NameSet& on, const NameSet& doing){
+        const auto formula = identify(on, doing);
+        if(formula == nullptr) GUM_ERROR(OperationNotAllowed, "no formula identifies the effect of " << doing << " on " << on)
+
+        // the probabilities of the formula are marginals over its variables : the network
+        // of their ancestors gives them exactly, whatever the horizon
+        auto ancestral = BayesNetFragment<GUM_SCALAR>(_bn_);
+        auto todo = std::vector<NodeId>();
+        for(const auto& n : variablesOf(*formula) + on + doing) todo.push_back(_cm_->idFromName(n));
+        while(!todo.empty()){
+            const auto n = todo.back();
+            todo.pop_back();
+            if(ancestral.isInstalledNode(n)) continue;
+            ancestral.installNode(n);
+            for(const auto& p : _bn_.parents(n)) todo.push_back(p);
+        }
+        return formula->eval(ancestral);
+    }
+
+    template<typename GUM_SCALAR>
+    bool DynamicCausalModel<GUM_SCALAR>::isDSep(const NameSet& x, const NameSet& y, const NameSet& zset){
+        const auto ix = _ids_(x);
+        const auto iy = _ids_(y);
+        const auto iz = _ids_(zset);
+        return _separated_.get("dsep" + _key_({&x, &y, &zset}), ix + iy + iz, [&](){
+            return gum::isDSep(*_cm_, ix, iy, iz);
+        });
+    }
+}
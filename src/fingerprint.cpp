@@ -0,0 +1,38 @@
+#include "fingerprint.h"
+
+namespace gum{
+
+    uint64_t fingerprint_mix(uint64_t h){
+        h += 0x9e3779b97f4a7c15ULL;
+        h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+        return h ^ (h >> 31);
+    }
+
+    uint64_t fingerprint_name(std::string_view name){
+        uint64_t h = 0xcbf29ce484222325ULL;
+        for(const auto c : name){
+            h ^= static_cast<unsigned char>(c);
+            h *= 0x100000001b3ULL;
+        }
+        return fingerprint_mix(h);
+    }
+
+    // the terms are tagged so that a node, an arc and a latent never collide by construction
+
+    uint64_t fingerprint_node(uint64_t name){
+        return fingerprint_mix(name ^ 0x6e6f6465ULL);
+    }
+
+    uint64_t fingerprint_arc(uint64_t tail, uint64_t head){
+        return fingerprint_mix(fingerprint_mix(tail ^ 0x61726373ULL) ^ head);
+    }
+
+    uint64_t fingerprint_child(uint64_t name){
+        return fingerprint_mix(name ^ 0x6368696cULL);
+    }
+
+    uint64_t fingerprint_latent(uint64_t children, Size count){
+        return count < 2 ? 0 : fingerprint_mix(children ^ 0x6c61746eULL);
+    }
+}
@@ -0,0 +1,95 @@
+#ifndef GUM_FINGERPRINT_H
+#define GUM_FINGERPRINT_H
+
+#include <agrum/tools/core/set.h>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace gum{
+
+    /**
+     * @brief Bijective 64-bit mixing function (splitmix64 finalizer) used to
+     * spread the hash of each element before combining them.
+     *
+     * @param h the value to mix
+     * @return uint64_t the mixed value
+     */
+    uint64_t fingerprint_mix(uint64_t h);
+
+    /**
+     * @brief Order independent hash of the structure of ``g`` : node ids and
+     * arcs. Two graphs with the same nodes and arcs always have the same
+     * fingerprint, whatever the order in which they were built.
+     *
+     * @tparam GraphT structure implementing a DAG-like interface
+     * @param g the graph
+     * @return uint64_t the fingerprint
+     */
+    template<typename GraphT>
+    uint64_t structural_fingerprint(const GraphT& g);
+
+    /**
+     * @brief Hash of a variable name (FNV-1a, then mixed), the identity of a 
+     * node in the canonical fingerprint of a causal model and the hash of the
+     * perfect hashing of @ref SymbolTable.
+     */
+    uint64_t fingerprint_name(std::string_view name);
+
+    /**
+     * @name Terms of the canonical fingerprint of a causal model
+     *
+     * The canonical fingerprint is the sum (modulo 2^64) of one term per 
+     * observed node, one term per arc between observed nodes and one term 
+     * per latent variable confounding at least two observed nodes, built 
+     * from the hashes of the names (see @ref fingerprint_name) : it depends 
+     * neither on the node ids nor on the names of the latent variables, and 
+     * it is maintained incrementally by adding and subtracting terms.
+     * @{
+     */
+
+    /// term of an observed node
+    uint64_t fingerprint_node(uint64_t name);
+
+    /// term of an arc between two observed nodes
+    uint64_t fingerprint_arc(uint64_t tail, uint64_t head);
+
+    /// contribution of an observed child to the children sum of a latent variable
+    uint64_t fingerprint_child(uint64_t name);
+
+    /// term of a latent variable, from the sum of the contributions of its observed children
+    uint64_t fingerprint_latent(uint64_t children, Size count);
+
+    /// @}
+
+    /**
+     * @brief Canonical fingerprint of a causal model or of a view of one 
+     * (see @ref fingerprint_node), computed from scratch in O(|V|+|E|)
+     *
+     * @tparam ModelT structure implementing the interface of @ref CausalModel 
+     * (nodes, children, latentVariablesIds, names)
+     * @param cm the model
+     * @return uint64_t the fingerprint
+     */
+    template<typename ModelT>
+    uint64_t canonical_fingerprint(const ModelT& cm);
+
+    /**
+     * @brief Canonical fingerprint of a graph without latent variables whose 
+     * node ``n`` is named ``names[n]`` : the one of a causal model of the same 
+     * structure (see @ref canonical_fingerprint), which does not depend on 
+     * the node ids
+     *
+     * @tparam GraphT structure implementing a DAG-like interface
+     * @param g the graph
+     * @param names the names of the nodes, by id
+     * @return uint64_t the fingerprint
+     */
+    template<typename GraphT>
+    uint64_t canonical_fingerprint(const GraphT& g, const std::vector<std::string>& names);
+}
+
+#include "fingerprint_tpl.h"
+
+#endif
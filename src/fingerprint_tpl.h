@@ -0,0 +1,54 @@
+#include "fingerprint.h"
+
+namespace gum{
+
+    template<typename GraphT>
+    uint64_t structural_fingerprint(const GraphT& g){
+        // elements are combined by addition so that the result does not
+        // depend on the iteration order of the graph
+        uint64_t h = fingerprint_mix(g.nodes().size());
+        for(const auto& n : g.nodes()){
+            h += fingerprint_mix(uint64_t(n) + 1);
+            for(const auto& c : g.children(n)){
+                h += fingerprint_mix(fingerprint_mix(uint64_t(n) + 1) ^ (uint64_t(c) + 1));
+            }
+        }
+        return h;
+    }
+
+    template<typename ModelT>
+    uint64_t canonical_fingerprint(const ModelT& cm){
+        const auto& latents = cm.latentVariablesIds();
+        const auto& names = cm.names();
+        uint64_t h = 0;
+        for(const auto& n : cm.nodes()){
+            if(latents.contains(n)){
+                uint64_t children = 0;
+                Size count = 0;
+                for(const auto& c : cm.children(n)){
+                    if(latents.contains(c)) continue;
+                    children += fingerprint_child(fingerprint_name(names[c]));
+                    count++;
+                }
+                h += fingerprint_latent(children, count);
+                continue;
+            }
+            const auto name = fingerprint_name(names[n]);
+            h += fingerprint_node(name);
+            for(const auto& c : cm.children(n))
+                if(!latents.contains(c)) h += fingerprint_arc(name, fingerprint_name(names[c]));
+        }
+        return h;
+    }
+
+    template<typename GraphT>
+    uint64_t canonical_fingerprint(const GraphT& g, const std::vector<std::string>& names){
+        uint64_t h = 0;
+        for(const auto& n : g.nodes()){
+            const auto name = fingerprint_name(names[n]);
+            h += fingerprint_node(name);
+            for(const auto& c : g.children(n)) h += fingerprint_arc(name, fingerprint_name(names[c]));
+        }
+        return h;
+    }
+}
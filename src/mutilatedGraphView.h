@@ -0,0 +1,108 @@
+#ifndef GUM_MUTILATED_GRAPH_VIEW_H
+#define GUM_MUTILATED_GRAPH_VIEW_H
+
+#include <agrum/tools/core/set.h>
+#include <agrum/tools/core/hashTable.h>
+#include <agrum/tools/graphs/graphElements.h>
+#include <vector>
+
+namespace gum{
+
+    /**
+     * @class MutilatedGraphView
+     * @brief Read-only view of a DAG-like graph ``g`` in which the arcs 
+     * entering the nodes of ``cutIn`` and the arcs leaving the nodes of 
+     * ``cutOut`` are removed : the graphs \f( G_{\overline{X}} \f), 
+     * \f( G_{\underline{Z}} \f) and \f( G_{\overline{X}\underline{Z}} \f)
+     * of the do-calculus.
+     *
+     * The underlying graph is never modified, so several views (and 
+     * queries) can share it concurrently. Only the parents and children 
+     * lists of the nodes touched by a removed arc are stored, the others 
+     * are read from ``g``. The view implements the DAG-like interface 
+     * expected by the ``GraphT`` algorithms.
+     *
+     * @tparam GraphT structure implementing a DAG-like interface
+     * @warning ``g`` must outlive the view and must not change while the view is used
+     */
+    template<typename GraphT>
+    class MutilatedGraphView {
+    private:
+        const GraphT& _g_;
+        NodeSet _cutIn_;  ///< nodes whose entering arcs are removed
+        NodeSet _cutOut_; ///< nodes whose leaving arcs are removed
+        HashTable<NodeId, NodeSet> _parents_;  ///< the parents of the nodes touched by a removed arc
+        HashTable<NodeId, NodeSet> _children_; ///< the children of the nodes touched by a removed arc
+
+        bool _removed_(NodeId tail, NodeId head) const;
+
+    public:
+        /**
+         * @brief Builds the view
+         *
+         * @param g the graph
+         * @param cutIn the nodes whose entering arcs are removed
+         * @param cutOut the nodes whose leaving arcs are removed
+         */
+        MutilatedGraphView(const GraphT& g, const NodeSet& cutIn, const NodeSet& cutOut = NodeSet());
+        MutilatedGraphView(const MutilatedGraphView<GraphT>& other);
+        ~MutilatedGraphView();
+        MutilatedGraphView() = delete;
+
+        /// the underlying graph
+        const GraphT& graph() const;
+
+        /// the nodes whose entering arcs are removed
+        const NodeSet& cutIn() const;
+
+        /// the nodes whose leaving arcs are removed
+        const NodeSet& cutOut() const;
+
+        /// the nodes (the ones of the underlying graph)
+        decltype(auto) nodes() const;
+
+        /// number of nodes
+        Size size() const;
+
+        /// whether ``n`` is a node of the graph
+        bool exists(NodeId n) const;
+
+        /// parents of ``n`` in the view
+        const NodeSet& parents(NodeId n) const;
+
+        /// children of ``n`` in the view
+        const NodeSet& children(NodeId n) const;
+
+        /// whether the arc ``tail -> head`` is in the view
+        bool existsArc(NodeId tail, NodeId head) const;
+
+        /// the arcs of the view (built on each call)
+        ArcSet arcs() const;
+
+        /// number of arcs of the view
+        Size sizeArcs() const;
+
+        /// ancestors of ``n`` in the view (``n`` excluded)
+        NodeSet ancestors(NodeId n) const;
+
+        /// descendants of ``n`` in the view (``n`` excluded)
+        NodeSet descendants(NodeId n) const;
+    };
+
+    /**
+     * @brief Returns the view of ``g`` without the arcs entering the nodes of ``X`` 
+     * (the graph of an intervention on ``X``)
+     */
+    template<typename GraphT>
+    MutilatedGraphView<GraphT> cut_incoming_arcs(const GraphT& g, const NodeSet& X);
+
+    /**
+     * @brief Returns the view of ``g`` without the arcs leaving the nodes of ``Z``
+     */
+    template<typename GraphT>
+    MutilatedGraphView<GraphT> cut_outgoing_arcs(const GraphT& g, const NodeSet& Z);
+}
+
+#include "mutilatedGraphView_tpl.h"
+
+#endif
@@ -0,0 +1,147 @@
+#include "mutilatedGraphView.h"
+
+namespace gum{
+
+    template<typename GraphT>
+    MutilatedGraphView<GraphT>::MutilatedGraphView(const GraphT& g, const NodeSet& cutIn, const NodeSet& cutOut)
+        : _g_(g), _cutIn_(cutIn), _cutOut_(cutOut), _parents_(), _children_()
+    {
+        // copies of the lists losing an arc: the entering arcs of cutIn and the leaving arcs of cutOut
+        auto touch = [&](NodeId tail, NodeId head){
+            if(!_children_.exists(tail)) _children_.insert(tail, NodeSet(_g_.children(tail)));
+            _children_[tail].erase(head);
+            if(!_parents_.exists(head)) _parents_.insert(head, NodeSet(_g_.parents(head)));
+            _parents_[head].erase(tail);
+        };
+        for(const auto& n : _cutIn_){
+            if(!_g_.exists(n)) continue;
+            for(const auto& p : _g_.parents(n)) touch(p, n);
+        }
+        for(const auto& n : _cutOut_){
+            if(!_g_.exists(n)) continue;
+            for(const auto& c : _g_.children(n)) touch(n, c);
+        }
+        GUM_CONSTRUCTOR(MutilatedGraphView)
+    }
+
+    template<typename GraphT>
+    MutilatedGraphView<GraphT>::MutilatedGraphView(const MutilatedGraphView<GraphT>& other)
+        : _g_(other._g_), _cutIn_(other._cutIn_), _cutOut_(other._cutOut_), _parents_(other._parents_), _children_(other._children_)
+    {
+        GUM_CONS_CPY(MutilatedGraphView)
+    }
+
+    template<typename GraphT>
+    MutilatedGraphView<GraphT>::~MutilatedGraphView(){
+        GUM_DESTRUCTOR(MutilatedGraphView)
+    }
+
+    template<typename GraphT>
+    bool MutilatedGraphView<GraphT>::_removed_(NodeId tail, NodeId head) const {
+        return _cutIn_.contains(head) || _cutOut_.contains(tail);
+    }
+
+    template<typename GraphT>
+    const GraphT& MutilatedGraphView<GraphT>::graph() const {
+        return _g_;
+    }
+
+    template<typename GraphT>
+    const NodeSet& MutilatedGraphView<GraphT>::cutIn() const {
+        return _cutIn_;
+    }
+
+    template<typename GraphT>
+    const NodeSet& MutilatedGraphView<GraphT>::cutOut() const {
+        return _cutOut_;
+    }
+
+    template<typename GraphT>
+    decltype(auto) MutilatedGraphView<GraphT>::nodes() const {
+        return _g_.nodes();
+    }
+
+    template<typename GraphT>
+    Size MutilatedGraphView<GraphT>::size() const {
+        return _g_.size();
+    }
+
+    template<typename GraphT>
+    bool MutilatedGraphView<GraphT>::exists(NodeId n) const {
+        return _g_.exists(n);
+    }
+
+    template<typename GraphT>
+    const NodeSet& MutilatedGraphView<GraphT>::parents(NodeId n) const {
+        if(_parents_.exists(n)) return _parents_[n];
+        return _g_.parents(n);
+    }
+
+    template<typename GraphT>
+    const NodeSet& MutilatedGraphView<GraphT>::children(NodeId n) const {
+        if(_children_.exists(n)) return _children_[n];
+        return _g_.children(n);
+    }
+
+    template<typename GraphT>
+    bool MutilatedGraphView<GraphT>::existsArc(NodeId tail, NodeId head) const {
+        return !_removed_(tail, head) && _g_.existsArc(tail, head);
+    }
+
+    template<typename GraphT>
+    ArcSet MutilatedGraphView<GraphT>::arcs() const {
+        auto res = ArcSet();
+        for(const auto& a : _g_.arcs())
+            if(!_removed_(a.tail(), a.head())) res.insert(a);
+        return res;
+    }
+
+    template<typename GraphT>
+    Size MutilatedGraphView<GraphT>::sizeArcs() const {
+        Size res = 0;
+        for(const auto& n : nodes()) res += parents(n).size();
+        return res;
+    }
+
+    template<typename GraphT>
+    NodeSet MutilatedGraphView<GraphT>::ancestors(NodeId n) const {
+        auto res = NodeSet();
+        auto stack = std::vector<NodeId>({n});
+        while(!stack.empty()){
+            const auto x = stack.back();
+            stack.pop_back();
+            for(const auto& p : parents(x)){
+                if(res.contains(p)) continue;
+                res.insert(p);
+                stack.push_back(p);
+            }
+        }
+        return res;
+    }
+
+    template<typename GraphT>
+    NodeSet MutilatedGraphView<GraphT>::descendants(NodeId n) const {
+        auto res = NodeSet();
+        auto stack = std::vector<NodeId>({n});
+        while(!stack.empty()){
+            const auto x = stack.back();
+            stack.pop_back();
+            for(const auto& c : children(x)){
+                if(res.contains(c)) continue;
+                res.insert(c);
+                stack.push_back(c);
+            }
+        }
+        return res;
+    }
+
+    template<typename GraphT>
+    MutilatedGraphView<GraphT> cut_incoming_arcs(const GraphT& g, const NodeSet& X){
+        return MutilatedGraphView<GraphT>(g, X);
+    }
+
+    template<typename GraphT>
+    MutilatedGraphView<GraphT> cut_outgoing_arcs(const GraphT& g, const NodeSet& Z){
+        return MutilatedGraphView<GraphT>(g, NodeSet(), Z);
+    }
+}
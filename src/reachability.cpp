@@ -0,0 +1,511 @@
+#include "reachability.h"
+
+#include <utility>
+#include <algorithm>
+#include <bit>
+#include <limits>
+
+#ifdef GUM_NO_INLINE
+#  include "reachability_inl.h"
+#endif
+
+namespace gum{
+
+    CompactDigraph::CompactDigraph(const CompactDigraph& other)
+        : _exists_(other._exists_), _choffsets_(other._choffsets_), _children_(other._children_),
+          _paoffsets_(other._paoffsets_), _parents_(other._parents_)
+    {
+        GUM_CONS_CPY(CompactDigraph)
+    }
+
+    CompactDigraph::CompactDigraph(CompactDigraph&& other)
+        : _exists_(std::move(other._exists_)), _choffsets_(std::move(other._choffsets_)),
+          _children_(std::move(other._children_)), _paoffsets_(std::move(other._paoffsets_)),
+          _parents_(std::move(other._parents_))
+    {
+        GUM_CONS_MOV(CompactDigraph)
+    }
+
+    CompactDigraph::~CompactDigraph(){
+        GUM_DESTRUCTOR(CompactDigraph)
+    }
+
+    Size CompactDigraph::size() const {
+        return std::count(_exists_.begin(), _exists_.end(), 1);
+    }
+
+    std::vector<NodeId> CompactDigraph::topologicalOrder() const {
+        auto order = std::vector<NodeId>();
+        order.reserve(bound());
+        auto indeg = std::vector<Size>(bound(), 0);
+        for(NodeId n = 0; n < bound(); n++){
+            if(!_exists_[n]) continue;
+            indeg[n] = parents(n).size();
+            if(indeg[n] == 0) order.push_back(n);
+        }
+        for(Size i = 0; i < order.size(); i++){
+            for(const auto c : children(order[i])){
+                if(--indeg[c] == 0) order.push_back(c);
+            }
+        }
+        return order;
+    }
+
+
+    DipathOracle::DipathOracle(const DipathOracle& other)
+        : _g_(other._g_), _stamps_(other._stamps_.size(), 0), _stamp_(0), _stack_()
+    {
+        _stack_.reserve(_stamps_.size());
+        GUM_CONS_CPY(DipathOracle)
+    }
+
+    DipathOracle::DipathOracle(DipathOracle&& other)
+        : _g_(std::move(other._g_)), _stamps_(std::move(other._stamps_)),
+          _stamp_(std::exchange(other._stamp_, 0)), _stack_(std::move(other._stack_))
+    {
+        GUM_CONS_MOV(DipathOracle)
+    }
+
+    DipathOracle::~DipathOracle(){
+        GUM_DESTRUCTOR(DipathOracle)
+    }
+
+    Size DipathOracle::bound() const {
+        return _g_.bound();
+    }
+
+    Size DipathOracle::_newStamp_() const {
+        if(++_stamp_ == 0){
+            // the counter wrapped around: old stamps could collide with new ones
+            std::fill(_stamps_.begin(), _stamps_.end(), 0);
+            _stamp_ = 1;
+        }
+        return _stamp_;
+    }
+
+    bool DipathOracle::exists(NodeId x, NodeId y, const NodeSet& zset) const {
+        if(!_g_.exists(x) || !_g_.exists(y)) return false;
+        const auto stamp = _newStamp_();
+        for(const auto& z : zset)
+            if(z < bound()) _stamps_[z] = stamp;
+        _stamps_[x] = stamp;
+
+        _stack_.clear();
+        _stack_.push_back(x);
+        while(!_stack_.empty()){
+            const auto n = _stack_.back();
+            _stack_.pop_back();
+            for(const auto c : _g_.children(n)){
+                if(c == y) return true;
+                if(_stamps_[c] == stamp) continue;
+                _stamps_[c] = stamp;
+                _stack_.push_back(c);
+            }
+        }
+        return false;
+    }
+
+    void DipathOracle::_markReach_(NodeId from, bool forward, std::vector<char>& mark) const {
+        _stack_.clear();
+        _stack_.push_back(from);
+        while(!_stack_.empty()){
+            const auto n = _stack_.back();
+            _stack_.pop_back();
+            for(const auto c : (forward ? _g_.children(n) : _g_.parents(n))){
+                if(mark[c]) continue;
+                mark[c] = 1;
+                _stack_.push_back(c);
+            }
+        }
+    }
+
+    std::vector<bool> DipathOracle::exists(NodeId x, NodeId y, const std::vector<NodeSet>& zsets) const {
+        auto res = std::vector<bool>(zsets.size(), false);
+        if(!_g_.exists(x) || !_g_.exists(y)) return res;
+
+        auto fwd = std::vector<char>(bound(), 0);
+        _markReach_(x, true, fwd);
+        if(!fwd[y]) return res;
+
+        for(const auto c : _g_.children(x)){
+            if(c != y) continue;
+            std::fill(res.begin(), res.end(), true);
+            return res;
+        }
+
+        // relevant nodes : the ones lying on a directed path from x to y
+        auto bwd = std::vector<char>(bound(), 0);
+        _markReach_(y, false, bwd);
+        for(Size n = 0; n < bound(); n++) fwd[n] = fwd[n] && bwd[n];
+        fwd[y] = 0;
+
+        for(Size k = 0; k < zsets.size(); k++){
+            bool touches = false;
+            for(const auto& z : zsets[k]){
+                if(z < bound() && fwd[z]){
+                    touches = true;
+                    break;
+                }
+            }
+            if(!touches){
+                res[k] = true;
+                continue;
+            }
+
+            // search restricted to the relevant nodes
+            const auto stamp = _newStamp_();
+            for(const auto& z : zsets[k])
+                if(z < bound()) _stamps_[z] = stamp;
+            _stack_.clear();
+            _stack_.push_back(x);
+            bool found = false;
+            while(!found && !_stack_.empty()){
+                const auto n = _stack_.back();
+                _stack_.pop_back();
+                for(const auto c : _g_.children(n)){
+                    if(c == y){
+                        found = true;
+                        break;
+                    }
+                    if(!fwd[c] || _stamps_[c] == stamp) continue;
+                    _stamps_[c] = stamp;
+                    _stack_.push_back(c);
+                }
+            }
+            res[k] = found;
+        }
+        return res;
+    }
+
+    NodeSet DipathOracle::forwardReach(NodeId x) const {
+        auto s = NodeSet();
+        if(!_g_.exists(x)) return s;
+        auto mark = std::vector<char>(bound(), 0);
+        _markReach_(x, true, mark);
+        for(Size n = 0; n < bound(); n++)
+            if(mark[n]) s.insert(n);
+        return s;
+    }
+
+    NodeSet DipathOracle::backwardReach(NodeId y) const {
+        auto s = NodeSet();
+        if(!_g_.exists(y)) return s;
+        auto mark = std::vector<char>(bound(), 0);
+        _markReach_(y, false, mark);
+        for(Size n = 0; n < bound(); n++)
+            if(mark[n]) s.insert(n);
+        return s;
+    }
+
+
+    BackdoorReachIndex::BackdoorReachIndex(const BackdoorReachIndex& other)
+        : _bound_(other._bound_), _words_(other._words_), _rowOf_(other._rowOf_), _rows_(other._rows_)
+    {
+        GUM_CONS_CPY(BackdoorReachIndex)
+    }
+
+    BackdoorReachIndex::BackdoorReachIndex(BackdoorReachIndex&& other)
+        : _bound_(std::exchange(other._bound_, 0)), _words_(std::exchange(other._words_, 0)),
+          _rowOf_(std::move(other._rowOf_)), _rows_(std::move(other._rows_))
+    {
+        GUM_CONS_MOV(BackdoorReachIndex)
+    }
+
+    BackdoorReachIndex::~BackdoorReachIndex(){
+        GUM_DESTRUCTOR(BackdoorReachIndex)
+    }
+
+    void BackdoorReachIndex::_build_(const CompactDigraph& g, const std::vector<NodeId>& sources){
+        _bound_ = g.bound();
+        _words_ = (_bound_ + 63) / 64;
+        _rowOf_.assign(_bound_, _bound_);
+        _rows_.assign(sources.size() * _words_, 0);
+        for(Size i = 0; i < sources.size(); i++) _rowOf_[sources[i]] = i;
+
+        const auto order = g.topologicalOrder();
+        auto up = std::vector<uint64_t>(_bound_, 0);   // bit j : ancestor (or self) of a parent of source j
+        auto down = std::vector<uint64_t>(_bound_, 0); // bit j : in the backdoor reach of source j
+        auto srcBit = std::vector<uint64_t>(_bound_, 0);
+
+        for(Size start = 0; start < sources.size(); start += 64){
+            const Size k = std::min<Size>(64, sources.size() - start);
+            std::fill(up.begin(), up.end(), 0);
+            for(Size j = 0; j < k; j++){
+                const auto a = sources[start + j];
+                srcBit[a] = uint64_t(1) << j;
+                for(const auto p : g.parents(a)) up[p] |= srcBit[a];
+            }
+
+            // upward part of the trek : children are visited before their parents
+            for(auto it = order.rbegin(); it != order.rend(); ++it){
+                for(const auto c : g.children(*it)) up[*it] |= up[c];
+            }
+
+            // downward part : a source never propagates its own bit
+            for(const auto v : order){
+                auto w = up[v];
+                for(const auto p : g.parents(v)) w |= down[p];
+                down[v] = w & ~srcBit[v];
+            }
+
+            for(const auto v : order){
+                auto w = down[v];
+                while(w != 0){
+                    const auto j = std::countr_zero(w);
+                    _rows_[(start + j) * _words_ + v / 64] |= uint64_t(1) << (v % 64);
+                    w &= w - 1;
+                }
+            }
+            for(Size j = 0; j < k; j++) srcBit[sources[start + j]] = 0;
+        }
+    }
+
+    const uint64_t* BackdoorReachIndex::_row_(NodeId a) const {
+        if(!contains(a)) GUM_ERROR(NotFound, "node " << a << " is not in the backdoor reach index")
+        return _rows_.data() + _rowOf_[a] * _words_;
+    }
+
+    bool BackdoorReachIndex::contains(NodeId a) const {
+        return a < _bound_ && _rowOf_[a] != _bound_;
+    }
+
+    bool BackdoorReachIndex::reaches(NodeId a, NodeId v) const {
+        const auto row = _row_(a);
+        if(v >= _bound_) return false;
+        return (row[v / 64] >> (v % 64)) & 1;
+    }
+
+    bool BackdoorReachIndex::intersects(NodeId a, const NodeSet& s) const {
+        const auto row = _row_(a);
+        for(const auto& v : s){
+            if(v < _bound_ && ((row[v / 64] >> (v % 64)) & 1)) return true;
+        }
+        return false;
+    }
+
+    NodeSet BackdoorReachIndex::reach(NodeId a) const {
+        const auto row = _row_(a);
+        auto s = NodeSet();
+        for(Size w = 0; w < _words_; w++){
+            auto bits = row[w];
+            while(bits != 0){
+                s.insert(w * 64 + std::countr_zero(bits));
+                bits &= bits - 1;
+            }
+        }
+        return s;
+    }
+
+
+    DominatorTree::DominatorTree(const DominatorTree& other)
+        : _root_(other._root_), _idom_(other._idom_)
+    {
+        GUM_CONS_CPY(DominatorTree)
+    }
+
+    DominatorTree::DominatorTree(DominatorTree&& other)
+        : _root_(other._root_), _idom_(std::move(other._idom_))
+    {
+        GUM_CONS_MOV(DominatorTree)
+    }
+
+    DominatorTree::~DominatorTree(){
+        GUM_DESTRUCTOR(DominatorTree)
+    }
+
+    void DominatorTree::_build_(const CompactDigraph& g){
+        const Size none = g.bound();
+        _idom_.assign(none, none);
+        if(!g.exists(_root_)) return;
+
+        // depth-first numbering from the root (1-based, 0 if unreachable)
+        auto num = std::vector<Size>(none, 0);
+        auto vertex = std::vector<NodeId>(1, none);
+        auto dfsParent = std::vector<NodeId>(none, none);
+        auto stack = std::vector<std::pair<NodeId, Size>>({{_root_, 0}});
+        num[_root_] = 1;
+        vertex.push_back(_root_);
+        while(!stack.empty()){
+            auto& [v, next] = stack.back();
+            const auto children = g.children(v);
+            if(next == children.size()){
+                stack.pop_back();
+                continue;
+            }
+            const auto c = children.begin()[next++];
+            if(num[c] != 0) continue;
+            num[c] = vertex.size();
+            vertex.push_back(c);
+            dfsParent[c] = v;
+            stack.push_back({c, 0});
+        }
+
+        auto semi = num;                                 // semi-dominators, as dfs numbers
+        auto ancestor = std::vector<NodeId>(none, none); // the forest of the processed nodes
+        auto label = std::vector<NodeId>(none, none);
+        for(Size i = 1; i < vertex.size(); i++) label[vertex[i]] = vertex[i];
+        auto bucket = std::vector<std::vector<NodeId>>(none);
+        auto path = std::vector<NodeId>();
+
+        // node of minimal semi-dominator on the forest path above v, with path compression
+        auto eval = [&](NodeId v){
+            if(ancestor[v] == none) return v;
+            path.clear();
+            for(auto x = v; ancestor[ancestor[x]] != none; x = ancestor[x]) path.push_back(x);
+            while(!path.empty()){
+                const auto x = path.back();
+                path.pop_back();
+                const auto a = ancestor[x];
+                if(semi[label[a]] < semi[label[x]]) label[x] = label[a];
+                ancestor[x] = ancestor[a];
+            }
+            return label[v];
+        };
+
+        for(Size i = vertex.size() - 1; i >= 2; i--){
+            const auto w = vertex[i];
+            for(const auto v : g.parents(w)){
+                if(num[v] == 0) continue;
+                const auto u = eval(v);
+                if(semi[u] < semi[w]) semi[w] = semi[u];
+            }
+            bucket[vertex[semi[w]]].push_back(w);
+            const auto p = dfsParent[w];
+            ancestor[w] = p;
+            for(const auto v : bucket[p]){
+                const auto u = eval(v);
+                _idom_[v] = semi[u] < semi[v] ? u : p;
+            }
+            bucket[p].clear();
+        }
+        for(Size i = 2; i < vertex.size(); i++){
+            const auto w = vertex[i];
+            if(_idom_[w] != vertex[semi[w]]) _idom_[w] = _idom_[_idom_[w]];
+        }
+        _idom_[_root_] = _root_;
+    }
+
+    NodeId DominatorTree::root() const {
+        return _root_;
+    }
+
+    bool DominatorTree::reachable(NodeId n) const {
+        return n < _idom_.size() && _idom_[n] != _idom_.size();
+    }
+
+    NodeId DominatorTree::idom(NodeId n) const {
+        if(!reachable(n) || n == _root_) GUM_ERROR(NotFound, "node " << n << " has no immediate dominator")
+        return _idom_[n];
+    }
+
+    bool DominatorTree::dominates(NodeId a, NodeId b) const {
+        if(!reachable(a) || !reachable(b)) return false;
+        for(auto n = b; ; n = _idom_[n]){
+            if(n == a) return true;
+            if(n == _root_) return false;
+        }
+    }
+
+    std::vector<NodeId> DominatorTree::dominators(NodeId n) const {
+        auto res = std::vector<NodeId>();
+        if(!reachable(n)) return res;
+        for(auto d = n; d != _root_; ){
+            d = _idom_[d];
+            res.push_back(d);
+        }
+        std::reverse(res.begin(), res.end());
+        return res;
+    }
+
+
+    std::optional<NodeSet> _RCH_min_vertex_cut_(const CompactDigraph& g, NodeId x, NodeId y, const std::vector<double>& cost){
+        if(!g.exists(x) || !g.exists(y) || x == y) return std::nullopt;
+        const Size bound = g.bound();
+        const auto inf = std::numeric_limits<double>::infinity();
+
+        // relevant nodes : the ones on a directed path from x to y
+        auto fwd = std::vector<char>(bound, 0);
+        auto bwd = std::vector<char>(bound, 0);
+        auto stack = std::vector<NodeId>({x});
+        fwd[x] = 1;
+        while(!stack.empty()){
+            const auto n = stack.back();
+            stack.pop_back();
+            for(const auto c : g.children(n)){
+                if(fwd[c]) continue;
+                fwd[c] = 1;
+                stack.push_back(c);
+            }
+        }
+        if(!fwd[y]) return NodeSet(); // nothing to intercept
+        stack.push_back(y);
+        bwd[y] = 1;
+        while(!stack.empty()){
+            const auto n = stack.back();
+            stack.pop_back();
+            for(const auto p : g.parents(n)){
+                if(bwd[p]) continue;
+                bwd[p] = 1;
+                stack.push_back(p);
+            }
+        }
+
+        // split network : node n gives 2n (entering) and 2n+1 (leaving)
+        struct Arc { Size to; double cap; };
+        auto arcs = std::vector<Arc>();
+        auto out = std::vector<std::vector<Size>>(2 * bound);
+        auto addArc = [&](Size from, Size to, double cap){
+            out[from].push_back(arcs.size());
+            arcs.push_back(Arc{to, cap});
+            out[to].push_back(arcs.size());
+            arcs.push_back(Arc{from, 0}); // residual arc, at index ^ 1
+        };
+        for(NodeId n = 0; n < bound; n++){
+            if(!fwd[n] || !bwd[n]) continue;
+            addArc(2 * n, 2 * n + 1, (n == x || n == y) ? inf : cost[n]);
+            for(const auto c : g.children(n))
+                if(fwd[c] && bwd[c]) addArc(2 * n + 1, 2 * c, inf);
+        }
+        const Size source = 2 * x + 1;
+        const Size sink = 2 * y;
+
+        auto pred = std::vector<Size>(2 * bound);
+        auto seen = std::vector<char>(2 * bound);
+        auto queue = std::vector<Size>();
+        auto bfs = [&](){
+            std::fill(seen.begin(), seen.end(), 0);
+            queue.assign(1, source);
+            seen[source] = 1;
+            for(Size i = 0; i < queue.size(); i++){
+                const auto u = queue[i];
+                for(const auto a : out[u]){
+                    const auto v = arcs[a].to;
+                    if(seen[v] || arcs[a].cap <= 0) continue;
+                    seen[v] = 1;
+                    pred[v] = a;
+                    if(v == sink) return true;
+                    queue.push_back(v);
+                }
+            }
+            return false;
+        };
+
+        while(bfs()){
+            auto flow = inf;
+            for(auto v = sink; v != source; v = arcs[pred[v] ^ 1].to) flow = std::min(flow, arcs[pred[v]].cap);
+            if(flow == inf) return std::nullopt; // a path made of uncuttable nodes
+            for(auto v = sink; v != source; v = arcs[pred[v] ^ 1].to){
+                arcs[pred[v]].cap -= flow;
+                arcs[pred[v] ^ 1].cap += flow;
+            }
+        }
+
+        // the cut : the nodes entered but not left from the source side
+        auto cut = NodeSet();
+        for(NodeId n = 0; n < bound; n++){
+            if(!fwd[n] || !bwd[n] || n == x || n == y) continue;
+            if(seen[2 * n] && !seen[2 * n + 1]) cut.insert(n);
+        }
+        return cut;
+    }
+}
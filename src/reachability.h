@@ -0,0 +1,369 @@
+#ifndef GUM_REACHABILITY_H
+#define GUM_REACHABILITY_H
+
+#include <agrum/tools/core/set.h>
+#include <agrum/tools/core/hashTable.h>
+#include <agrum/tools/graphs/graphElements.h>
+#include <vector>
+#include <cstdint>
+#include <optional>
+
+namespace gum{
+
+    /**
+     * @brief A contiguous range of node ids, as returned by @ref CompactDigraph
+     */
+    struct NodeRange {
+        const NodeId* first;
+        const NodeId* last;
+        INLINE const NodeId* begin() const;
+        INLINE const NodeId* end() const;
+        INLINE Size size() const;
+        INLINE bool empty() const;
+    };
+
+    /**
+     * @class CompactDigraph
+     * @brief Read-only copy of the structure of a DAG-like graph, stored as
+     * compressed adjacency arrays (one for children, one for parents) 
+     * indexed by node id.
+     *
+     * Meant as a building block for the traversal-heavy utilities of this 
+     * file: it is built once in O(|V|+|E|) and never allocates afterwards.
+     */
+    class CompactDigraph {
+    private:
+        std::vector<char> _exists_;      ///< whether each id below the bound is a node
+        std::vector<Size> _choffsets_;   ///< offsets of each children list in _children_
+        std::vector<NodeId> _children_;  ///< concatenated children lists
+        std::vector<Size> _paoffsets_;   ///< offsets of each parents list in _parents_
+        std::vector<NodeId> _parents_;   ///< concatenated parents lists
+
+    public:
+        /**
+         * @brief Copies the structure of ``g``
+         *
+         * @tparam GraphT structure implementing a DAG-like interface
+         * @param g the graph
+         */
+        template<typename GraphT>
+        explicit CompactDigraph(const GraphT& g);
+
+        CompactDigraph(const CompactDigraph& other);
+        CompactDigraph(CompactDigraph&& other);
+        ~CompactDigraph();
+        CompactDigraph() = delete;
+
+        /// upper bound of the node ids
+        INLINE Size bound() const;
+
+        /// whether ``n`` is a node of the graph
+        INLINE bool exists(NodeId n) const;
+
+        /// children of ``n``
+        INLINE NodeRange children(NodeId n) const;
+
+        /// parents of ``n``
+        INLINE NodeRange parents(NodeId n) const;
+
+        /// number of nodes
+        Size size() const;
+
+        /// the nodes sorted such that parents come before their children
+        std::vector<NodeId> topologicalOrder() const;
+    };
+
+    /**
+     * @class DipathOracle
+     * @brief Answers "is there a directed path from ``x`` to ``y`` avoiding
+     * the nodes of ``zset``" on a fixed graph.
+     *
+     * The structure of the graph is copied once into compact adjacency
+     * arrays. Each query is an iterative search using per-query visit
+     * stamps (no set is cleared or allocated between queries) and stops
+     * as soon as ``y`` is reached.
+     *
+     * @warning the oracle keeps internal scratch buffers: a single instance
+     * must not be queried concurrently from several threads.
+     */
+    class DipathOracle {
+    private:
+        CompactDigraph _g_;
+
+        mutable std::vector<Size> _stamps_; ///< last query having visited each node
+        mutable Size _stamp_;               ///< current query stamp
+        mutable std::vector<NodeId> _stack_;
+
+        Size _newStamp_() const;
+        void _markReach_(NodeId from, bool forward, std::vector<char>& mark) const;
+
+    public:
+        /**
+         * @brief Builds the oracle from a DAG-like structure
+         *
+         * @tparam GraphT structure implementing a DAG-like interface
+         * @param g the graph
+         */
+        template<typename GraphT>
+        explicit DipathOracle(const GraphT& g);
+
+        DipathOracle(const DipathOracle& other);
+        DipathOracle(DipathOracle&& other);
+        ~DipathOracle();
+        DipathOracle() = delete;
+
+        /**
+         * @brief Predicate on the existence of a directed path from ``x`` to
+         * ``y`` whose intermediate nodes are not in ``zset``
+         *
+         * @param x source node
+         * @param y destination node
+         * @param zset blocking nodes
+         * @return true
+         * @return false
+         */
+        bool exists(NodeId x, NodeId y, const NodeSet& zset = NodeSet()) const;
+
+        /**
+         * @brief Batched version of @ref exists : evaluates every blocking set
+         * of ``zsets`` against the same pair ``(x, y)``.
+         *
+         * The nodes reachable from ``x`` and the nodes reaching ``y`` are
+         * computed once; a blocking set that does not meet their intersection
+         * is answered without any search, the others are searched inside
+         * that intersection only.
+         *
+         * @param x source node
+         * @param y destination node
+         * @param zsets the blocking sets
+         * @return std::vector<bool> the answer for each blocking set, in order
+         */
+        std::vector<bool> exists(NodeId x, NodeId y, const std::vector<NodeSet>& zsets) const;
+
+        /**
+         * @brief Returns the nodes reachable from ``x`` by a directed path (``x`` excluded)
+         */
+        NodeSet forwardReach(NodeId x) const;
+
+        /**
+         * @brief Returns the nodes from which ``y`` is reachable by a directed path (``y`` excluded)
+         */
+        NodeSet backwardReach(NodeId y) const;
+
+        /// upper bound of the node ids known by the oracle
+        Size bound() const;
+    };
+
+    /**
+     * @class BackdoorReachIndex
+     * @brief Stores, for a set of nodes ``a``, the result of @ref backdoor_reach :
+     * the nodes reachable from ``a`` by a trek starting with an arc into ``a``
+     * (going up from a parent of ``a``, then down), ``a`` never being crossed.
+     *
+     * The sets are computed for up to 64 nodes at once by two sweeps of the
+     * graph (one in reverse topological order for the upward part, one in
+     * topological order for the downward part) on 64-bit words, so the
+     * traversal work is shared between the nodes of a batch. Each result is
+     * stored as a bitset row indexed by node id.
+     */
+    class BackdoorReachIndex {
+    private:
+        Size _bound_;                     ///< upper bound of the node ids
+        Size _words_;                     ///< number of 64-bit words per row
+        std::vector<Size> _rowOf_;        ///< row of each computed node, _bound_ if none
+        std::vector<uint64_t> _rows_;     ///< the bitset rows, one after the other
+
+        void _build_(const CompactDigraph& g, const std::vector<NodeId>& sources);
+        const uint64_t* _row_(NodeId a) const;
+
+    public:
+        /**
+         * @brief Computes the backdoor reach of every node of ``g``
+         *
+         * @tparam GraphT structure implementing a DAG-like interface
+         * @param g the graph
+         */
+        template<typename GraphT>
+        explicit BackdoorReachIndex(const GraphT& g);
+
+        /**
+         * @brief Computes the backdoor reach of the nodes of ``subset`` only
+         *
+         * @tparam GraphT structure implementing a DAG-like interface
+         * @param g the graph
+         * @param subset the nodes for which the sets are needed
+         */
+        template<typename GraphT>
+        BackdoorReachIndex(const GraphT& g, const NodeSet& subset);
+
+        BackdoorReachIndex(const BackdoorReachIndex& other);
+        BackdoorReachIndex(BackdoorReachIndex&& other);
+        ~BackdoorReachIndex();
+        BackdoorReachIndex() = delete;
+
+        /// whether the backdoor reach of ``a`` is stored in this index
+        bool contains(NodeId a) const;
+
+        /**
+         * @brief Predicate on ``v`` belonging to the backdoor reach of ``a``
+         * @throw NotFound if ``a`` is not in the index
+         */
+        bool reaches(NodeId a, NodeId v) const;
+
+        /**
+         * @brief Predicate on ``s`` meeting the backdoor reach of ``a``
+         * @throw NotFound if ``a`` is not in the index
+         */
+        bool intersects(NodeId a, const NodeSet& s) const;
+
+        /**
+         * @brief Returns the backdoor reach of ``a`` as a NodeSet
+         * @throw NotFound if ``a`` is not in the index
+         */
+        NodeSet reach(NodeId a) const;
+    };
+
+    /**
+     * @class DominatorTree
+     * @brief Dominator tree of the nodes reachable from a root: ``a`` 
+     * dominates ``b`` when every directed path from the root to ``b`` goes 
+     * through ``a``.
+     *
+     * Built with the algorithm of Lengauer and Tarjan (semi-dominators 
+     * computed on a depth-first spanning tree, with path compression) in 
+     * O(|E| log |V|). The strict dominators of ``y`` other than the root 
+     * ``x`` are exactly the single nodes intercepting every directed path 
+     * from ``x`` to ``y``.
+     */
+    class DominatorTree {
+    private:
+        NodeId _root_;
+        std::vector<NodeId> _idom_; ///< immediate dominator of each node, the bound if unreachable (the root is its own)
+
+        void _build_(const CompactDigraph& g);
+
+    public:
+        /**
+         * @brief Computes the dominators of the nodes reachable from ``root``
+         *
+         * @tparam GraphT structure implementing a DAG-like interface
+         * @param g the graph
+         * @param root the root of the directed paths
+         */
+        template<typename GraphT>
+        DominatorTree(const GraphT& g, NodeId root);
+        DominatorTree(const DominatorTree& other);
+        DominatorTree(DominatorTree&& other);
+        ~DominatorTree();
+        DominatorTree() = delete;
+
+        /// the root of the tree
+        NodeId root() const;
+
+        /// whether ``n`` is reachable from the root (the root included)
+        bool reachable(NodeId n) const;
+
+        /**
+         * @brief Returns the immediate dominator of ``n``
+         * @throw NotFound if ``n`` is the root or is not reachable
+         */
+        NodeId idom(NodeId n) const;
+
+        /**
+         * @brief Predicate on ``a`` dominating ``b`` (every node dominates itself)
+         */
+        bool dominates(NodeId a, NodeId b) const;
+
+        /**
+         * @brief Returns the strict dominators of ``n``, from the root to its
+         * immediate dominator (empty for the root or an unreachable node)
+         */
+        std::vector<NodeId> dominators(NodeId n) const;
+    };
+
+    /**
+     * @brief Returns the nodes intercepting every directed path from ``x`` 
+     * to ``y`` on their own (``x`` and ``y`` excluded), in the order they 
+     * are met along the paths. Empty if there is no directed path.
+     *
+     * @tparam GraphT structure implementing a DAG-like interface
+     * @param g the graph
+     * @param x source node
+     * @param y destination node
+     * @return std::vector<NodeId> the dominators of ``y`` in the graph rooted in ``x``
+     */
+    template<typename GraphT>
+    std::vector<NodeId> dipath_interceptors(const GraphT& g, NodeId x, NodeId y);
+
+    /**
+     * @brief internal : minimum vertex cut of @ref min_vertex_cut on a compact graph,
+     * ``cost`` being indexed by node id (infinite for the nodes that cannot be cut)
+     */
+    std::optional<NodeSet> _RCH_min_vertex_cut_(const CompactDigraph& g, NodeId x, NodeId y, const std::vector<double>& cost);
+
+    /**
+     * @brief Returns a set of nodes of minimal total cost intercepting every
+     * directed path from ``x`` to ``y`` (``x`` and ``y`` excluded).
+     *
+     * Computed as a minimum cut in the graph of the nodes lying on these 
+     * paths, each node being split into an entering and a leaving copy 
+     * joined by an arc of capacity its cost (the other arcs being 
+     * uncapacitated), with augmenting shortest paths (Edmonds-Karp).
+     *
+     * @tparam GraphT structure implementing a DAG-like interface
+     * @param g the graph
+     * @param x source node
+     * @param y destination node
+     * @param cuttable the nodes that may be in the cut
+     * @param costs the cost of each node of ``cuttable``, 1 for the missing ones
+     * @return std::optional<NodeSet> nullopt if no set of ``cuttable`` intercepts every path
+     */
+    template<typename GraphT>
+    std::optional<NodeSet> min_vertex_cut(const GraphT& g, NodeId x, NodeId y, const NodeSet& cuttable, 
+                                          const HashTable<NodeId, double>& costs = HashTable<NodeId, double>());
+
+    /**
+     * @brief Returns the set of nodes lying on a directed path from ``x``
+     * to ``y`` (``x`` and ``y`` excluded), computed as the intersection of
+     * the descendants of ``x`` and the ancestors of ``y`` in O(|V|+|E|).
+     *
+     * @tparam GraphT structure implementing a DAG-like interface
+     * @param g the graph
+     * @param x source node
+     * @param y destination node
+     * @return NodeSet the (possibly empty) set of intermediate nodes
+     */
+    template<typename GraphT>
+    NodeSet nodes_on_dipaths(const GraphT& g, NodeId x, NodeId y);
+
+    /**
+     * @brief internal : the nodes of @ref nodes_on_dipaths, nullopt if there is no 
+     * directed path from ``x`` to ``y`` (told apart from an arc ``x -> y`` alone)
+     */
+    template<typename GraphT>
+    std::optional<NodeSet> _RCH_nodes_on_dipaths_(const GraphT& g, NodeId x, NodeId y);
+
+    /**
+     * @brief Predicate on the existence of a directed path from ``x`` to ``y`` in ``g``
+     * whose intermediate nodes are not in ``zset``, searched once with an early exit
+     * (for repeated queries on the same graph, prefer a @ref DipathOracle built once)
+     *
+     * @tparam GraphT structure implementing a DAG-like interface
+     * @param g the graph
+     * @param x source node
+     * @param y destination node
+     * @param zset blocking nodes
+     * @return true
+     * @return false
+     */
+    template<typename GraphT>
+    bool exists_dipath(const GraphT& g, NodeId x, NodeId y, const NodeSet& zset = NodeSet());
+}
+
+#include "reachability_tpl.h"
+
+#ifndef GUM_NO_INLINE
+#include "reachability_inl.h"
+#endif
+
+#endif
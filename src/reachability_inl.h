@@ -0,0 +1,26 @@
+
+namespace gum{
+    INLINE const NodeId* NodeRange::begin() const { return first; }
+
+    INLINE const NodeId* NodeRange::end() const { return last; }
+
+    INLINE Size NodeRange::size() const { return last - first; }
+
+    INLINE bool NodeRange::empty() const { return first == last; }
+
+    INLINE Size CompactDigraph::bound() const {
+        return _exists_.size();
+    }
+
+    INLINE bool CompactDigraph::exists(NodeId n) const {
+        return n < bound() && _exists_[n];
+    }
+
+    INLINE NodeRange CompactDigraph::children(NodeId n) const {
+        return NodeRange{_children_.data() + _choffsets_[n], _children_.data() + _choffsets_[n + 1]};
+    }
+
+    INLINE NodeRange CompactDigraph::parents(NodeId n) const {
+        return NodeRange{_parents_.data() + _paoffsets_[n], _parents_.data() + _paoffsets_[n + 1]};
+    }
+}
@@ -0,0 +1,152 @@
+#include "reachability.h"
+
+#include <limits>
+
+namespace gum{
+
+    template<typename GraphT>
+    CompactDigraph::CompactDigraph(const GraphT& g)
+        : _exists_(), _choffsets_(), _children_(), _paoffsets_(), _parents_()
+    {
+        const Size bound = g.nodes().bound();
+        _exists_.assign(bound, 0);
+        _choffsets_.assign(bound + 1, 0);
+        _paoffsets_.assign(bound + 1, 0);
+        for(const auto& n : g.nodes()){
+            _exists_[n] = 1;
+            _choffsets_[n + 1] = g.children(n).size();
+            _paoffsets_[n + 1] = g.parents(n).size();
+        }
+        for(Size i = 0; i < bound; i++){
+            _choffsets_[i + 1] += _choffsets_[i];
+            _paoffsets_[i + 1] += _paoffsets_[i];
+        }
+        _children_.resize(_choffsets_[bound]);
+        _parents_.resize(_paoffsets_[bound]);
+        for(const auto& n : g.nodes()){
+            auto c = _choffsets_[n];
+            for(const auto& ch : g.children(n)) _children_[c++] = ch;
+            auto p = _paoffsets_[n];
+            for(const auto& pa : g.parents(n)) _parents_[p++] = pa;
+        }
+        GUM_CONSTRUCTOR(CompactDigraph)
+    }
+
+    template<typename GraphT>
+    DipathOracle::DipathOracle(const GraphT& g)
+        : _g_(g), _stamps_(), _stamp_(0), _stack_()
+    {
+        _stamps_.assign(_g_.bound(), 0);
+        _stack_.reserve(_g_.bound());
+        GUM_CONSTRUCTOR(DipathOracle)
+    }
+
+    template<typename GraphT>
+    BackdoorReachIndex::BackdoorReachIndex(const GraphT& g)
+        : _bound_(0), _words_(0), _rowOf_(), _rows_()
+    {
+        const auto cg = CompactDigraph(g);
+        auto sources = std::vector<NodeId>();
+        for(NodeId n = 0; n < cg.bound(); n++)
+            if(cg.exists(n)) sources.push_back(n);
+        _build_(cg, sources);
+        GUM_CONSTRUCTOR(BackdoorReachIndex)
+    }
+
+    template<typename GraphT>
+    BackdoorReachIndex::BackdoorReachIndex(const GraphT& g, const NodeSet& subset)
+        : _bound_(0), _words_(0), _rowOf_(), _rows_()
+    {
+        const auto cg = CompactDigraph(g);
+        auto sources = std::vector<NodeId>();
+        for(const auto& n : subset)
+            if(cg.exists(n)) sources.push_back(n);
+        _build_(cg, sources);
+        GUM_CONSTRUCTOR(BackdoorReachIndex)
+    }
+
+    template<typename GraphT>
+    DominatorTree::DominatorTree(const GraphT& g, NodeId root)
+        : _root_(root), _idom_()
+    {
+        _build_(CompactDigraph(g));
+        GUM_CONSTRUCTOR(DominatorTree)
+    }
+
+    /**
+     * @brief internal marking of the nodes reachable from ``from`` following
+     * children (``forward``) or parents links
+     */
+    template<typename GraphT>
+    void _RCH_mark_(const GraphT& g, NodeId from, bool forward, std::vector<char>& mark){
+        auto stack = std::vector<NodeId>({from});
+        while(!stack.empty()){
+            const auto n = stack.back();
+            stack.pop_back();
+            for(const auto& m : (forward ? g.children(n) : g.parents(n))){
+                if(mark[m]) continue;
+                mark[m] = 1;
+                stack.push_back(m);
+            }
+        }
+    }
+
+    template<typename GraphT>
+    std::optional<NodeSet> _RCH_nodes_on_dipaths_(const GraphT& g, NodeId x, NodeId y){
+        const Size bound = g.nodes().bound();
+        auto desc = std::vector<char>(bound, 0);
+        _RCH_mark_(g, x, true, desc);
+        if(!desc[y]) return std::nullopt;
+
+        auto res = NodeSet();
+        auto anc = std::vector<char>(bound, 0);
+        _RCH_mark_(g, y, false, anc);
+        for(const auto& n : g.nodes()){
+            if(desc[n] && anc[n]) res.insert(n);
+        }
+        return res;
+    }
+
+    template<typename GraphT>
+    NodeSet nodes_on_dipaths(const GraphT& g, NodeId x, NodeId y){
+        auto res = _RCH_nodes_on_dipaths_(g, x, y);
+        return res ? std::move(*res) : NodeSet();
+    }
+
+    template<typename GraphT>
+    bool exists_dipath(const GraphT& g, NodeId x, NodeId y, const NodeSet& zset){
+        // stops as soon as y is reached
+        auto mark = std::vector<char>(g.nodes().bound(), 0);
+        auto stack = std::vector<NodeId>({x});
+        while(!stack.empty()){
+            const auto n = stack.back();
+            stack.pop_back();
+            for(const auto& c : g.children(n)){
+                if(c == y) return true;
+                if(mark[c] || zset.contains(c)) continue;
+                mark[c] = 1;
+                stack.push_back(c);
+            }
+        }
+        return false;
+    }
+
+    template<typename GraphT>
+    std::vector<NodeId> dipath_interceptors(const GraphT& g, NodeId x, NodeId y){
+        const auto dt = DominatorTree(g, x);
+        auto res = dt.dominators(y);
+        if(!res.empty()) res.erase(res.begin()); // the root
+        return res;
+    }
+
+    template<typename GraphT>
+    std::optional<NodeSet> min_vertex_cut(const GraphT& g, NodeId x, NodeId y, const NodeSet& cuttable, const HashTable<NodeId, double>& costs){
+        const auto cg = CompactDigraph(g);
+        auto cost = std::vector<double>(cg.bound(), std::numeric_limits<double>::infinity());
+        for(const auto& n : cuttable){
+            if(!cg.exists(n)) continue;
+            cost[n] = costs.exists(n) ? costs[n] : 1.0;
+        }
+        return _RCH_min_vertex_cut_(cg, x, y, cost);
+    }
+}
@@ -0,0 +1,141 @@
+#include "symbolTable.h"
+#include "fingerprint.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace gum{
+
+    SymbolTable::SymbolTable()
+        : _strings_(), _views_(), _index_(), _frozen_(false), _displacements_(), _slots_()
+    {
+        GUM_CONSTRUCTOR(SymbolTable)
+    }
+
+    SymbolTable::SymbolTable(const SymbolTable& other)
+        : SymbolTable()
+    {
+        // the views must point into our own copies of the names
+        for(const auto& v : other._views_) intern(v);
+        if(other._frozen_) freeze();
+        GUM_CONS_CPY(SymbolTable)
+    }
+
+    SymbolTable::SymbolTable(SymbolTable&& other)
+        : _strings_(std::move(other._strings_)), _views_(std::move(other._views_)), _index_(std::move(other._index_)),
+          _frozen_(std::exchange(other._frozen_, false)), _displacements_(std::move(other._displacements_)), _slots_(std::move(other._slots_))
+    {
+        GUM_CONS_MOV(SymbolTable)
+    }
+
+    SymbolTable::~SymbolTable(){
+        GUM_DESTRUCTOR(SymbolTable)
+    }
+
+    SymbolTable& SymbolTable::operator=(const SymbolTable& other){
+        if(this == &other) return *this;
+        _strings_.clear();
+        _views_.clear();
+        _index_.clear();
+        _frozen_ = false;
+        _displacements_.clear();
+        _slots_.clear();
+        for(const auto& v : other._views_) intern(v);
+        if(other._frozen_) freeze();
+        GUM_OP_CPY(SymbolTable)
+        return *this;
+    }
+
+    SymbolTable& SymbolTable::operator=(SymbolTable&& other){
+        _strings_ = std::move(other._strings_);
+        _views_ = std::move(other._views_);
+        _index_ = std::move(other._index_);
+        _frozen_ = std::exchange(other._frozen_, false);
+        _displacements_ = std::move(other._displacements_);
+        _slots_ = std::move(other._slots_);
+        GUM_OP_MOV(SymbolTable)
+        return *this;
+    }
+
+    std::size_t SymbolTable::_bucket_(std::uint64_t h) const {
+        return h % _displacements_.size();
+    }
+
+    std::size_t SymbolTable::_slot_(std::uint64_t h, std::uint32_t d) const {
+        return fingerprint_mix(h ^ (std::uint64_t(d) * 0x9e3779b97f4a7c15ULL)) % _slots_.size();
+    }
+
+    Symbol SymbolTable::intern(std::string_view name){
+        if(const auto it = _index_.find(name); it != _index_.end()) return it->second;
+        _frozen_ = false;
+        _strings_.emplace_back(name);
+        const auto s = static_cast<Symbol>(_views_.size());
+        _views_.push_back(_strings_.back());
+        _index_.emplace(_views_.back(), s);
+        return s;
+    }
+
+    Symbol SymbolTable::find(std::string_view name) const {
+        if(!_frozen_){
+            const auto it = _index_.find(name);
+            return it == _index_.end() ? none : it->second;
+        }
+        const auto h = fingerprint_name(name);
+        const auto s = _slots_[_slot_(h, _displacements_[_bucket_(h)])];
+        return (s != none && _views_[s] == name) ? s : none;
+    }
+
+    std::string_view SymbolTable::name(Symbol s) const {
+        if(s >= _views_.size()) GUM_ERROR(NotFound, "no symbol " << s << " in the table")
+        return _views_[s];
+    }
+
+    Size SymbolTable::size() const {
+        return _views_.size();
+    }
+
+    bool SymbolTable::frozen() const {
+        return _frozen_;
+    }
+
+    void SymbolTable::freeze(){
+        if(_frozen_) return;
+        const auto n = _views_.size();
+        _displacements_.assign(n / 4 + 1, 0);
+        _slots_.assign(n + n / 4 + 1, none);
+
+        auto hashes = std::vector<std::uint64_t>(n);
+        auto buckets = std::vector<std::vector<Symbol>>(_displacements_.size());
+        for(Symbol s = 0; s < n; s++){
+            hashes[s] = fingerprint_name(_views_[s]);
+            buckets[_bucket_(hashes[s])].push_back(s);
+        }
+
+        // the largest buckets are placed first, while the table is mostly empty
+        auto order = std::vector<std::size_t>(buckets.size());
+        for(std::size_t b = 0; b < order.size(); b++) order[b] = b;
+        std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b){ return buckets[a].size() > buckets[b].size(); });
+
+        auto taken = std::vector<std::size_t>();
+        for(const auto b : order){
+            if(buckets[b].empty()) break;
+            for(std::uint32_t d = 0; ; d++){
+                taken.clear();
+                bool ok = true;
+                for(const auto s : buckets[b]){
+                    const auto slot = _slot_(hashes[s], d);
+                    if(_slots_[slot] != none || std::find(taken.begin(), taken.end(), slot) != taken.end()){
+                        ok = false;
+                        break;
+                    }
+                    taken.push_back(slot);
+                }
+                if(!ok) continue;
+                for(std::size_t k = 0; k < taken.size(); k++) _slots_[taken[k]] = buckets[b][k];
+                _displacements_[b] = d;
+                break;
+            }
+        }
+        _frozen_ = true;
+    }
+}
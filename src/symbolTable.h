@@ -0,0 +1,82 @@
+#ifndef GUM_SYMBOL_TABLE_H
+#define GUM_SYMBOL_TABLE_H
+
+#include <agrum/tools/core/set.h>
+#include <string>
+#include <string_view>
+#include <deque>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <limits>
+
+namespace gum{
+
+    /// dense id of an interned name in a @ref SymbolTable
+    using Symbol = std::uint32_t;
+
+    /**
+     * @class SymbolTable
+     * @brief Interned strings (variable names) with dense ids : the i-th 
+     * interned name is the symbol i. Names are stored once and looked up 
+     * through ``std::string_view`` keys, so a symbol can be compared, 
+     * hashed and stored as an integer.
+     *
+     * Once the table is frozen, lookups go through a perfect hash 
+     * (hash and displace) built over the names : one hash of the key (the
+     * one of @ref fingerprint_name), one probe and one comparison.
+     * Interning a new name thaws the table, which falls back to an ordinary
+     * hash map until it is frozen again.
+     */
+    class SymbolTable {
+    private:
+        std::deque<std::string> _strings_;     ///< the names, never moved once interned
+        std::vector<std::string_view> _views_; ///< the name of each symbol
+        std::unordered_map<std::string_view, Symbol> _index_;
+
+        bool _frozen_;
+        std::vector<std::uint32_t> _displacements_; ///< displacement of each bucket of the perfect hash
+        std::vector<Symbol> _slots_;                ///< symbol in each slot, none if empty
+
+        std::size_t _bucket_(std::uint64_t h) const;
+        std::size_t _slot_(std::uint64_t h, std::uint32_t d) const;
+
+    public:
+        /// the symbol of no name
+        static constexpr Symbol none = std::numeric_limits<Symbol>::max();
+
+        SymbolTable();
+        SymbolTable(const SymbolTable& other);
+        SymbolTable(SymbolTable&& other);
+        ~SymbolTable();
+        SymbolTable& operator=(const SymbolTable& other);
+        SymbolTable& operator=(SymbolTable&& other);
+
+        /**
+         * @brief Returns the symbol of ``name``, interning it if needed (which thaws a frozen table)
+         */
+        Symbol intern(std::string_view name);
+
+        /**
+         * @brief Returns the symbol of ``name``, @ref none if it was never interned
+         */
+        Symbol find(std::string_view name) const;
+
+        /**
+         * @brief Returns the name of the symbol ``s``
+         * @throw NotFound if ``s`` is not a symbol of the table
+         */
+        std::string_view name(Symbol s) const;
+
+        /// number of symbols
+        Size size() const;
+
+        /// builds the perfect hash of the current names
+        void freeze();
+
+        /// whether the lookups use the perfect hash
+        bool frozen() const;
+    };
+}
+
+#endif
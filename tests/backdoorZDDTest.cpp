@@ -0,0 +1,150 @@
+#include <agrum/BN/BayesNet.h>
+#include <cmath>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "backdoorZDD.h"
+#include "doorCriteria.h"
+#include "dSeparation.h"
+#include "testUtils.h"
+
+using namespace gum;
+
+/// a set as a sorted vector, to compare families
+static std::vector<NodeId> sorted(const NodeSet& s){
+    auto res = std::vector<NodeId>(s.begin(), s.end());
+    std::sort(res.begin(), res.end());
+    return res;
+}
+
+/// the sets of a diagram
+static std::set<std::vector<NodeId>> family(const BackdoorZDD& zdd){
+    auto res = std::set<std::vector<NodeId>>();
+    for(const auto& s : zdd) res.insert(sorted(s));
+    return res;
+}
+
+/// Z1 opens the only backdoor path X <- Z1 -> Z2 -> Y, Z3 is a mere parent of Y
+static void testKnownFamily(){
+    const auto bn = BayesNet<double>::fastPrototype("Z1->X;Z1->Z2;Z2->Y;X->Y;Z3->Y");
+    const auto x = bn.idFromName("X"), y = bn.idFromName("Y");
+    const auto z1 = bn.idFromName("Z1"), z2 = bn.idFromName("Z2"), z3 = bn.idFromName("Z3");
+
+    // a set is a backdoor set if it holds Z1 or Z2, whatever Z3
+    const auto zdd = backdoor_zdd(bn, x, y);
+    const auto expected = std::set<std::vector<NodeId>>({
+        sorted({z1}), sorted({z2}), sorted({z1, z2}), sorted({z1, z3}), sorted({z2, z3}), sorted({z1, z2, z3})});
+    DOCALC_CHECK(zdd.count() == 6);
+    DOCALC_CHECK(family(zdd) == expected);
+
+    // the minimal sets of the family are the ones of the generator
+    auto minimal = std::set<std::vector<NodeId>>();
+    for(const auto& s : backdoor_generator(bn, x, y)) minimal.insert(sorted(s));
+    DOCALC_CHECK(minimal == std::set<std::vector<NodeId>>({sorted({z1}), sorted({z2})}));
+    for(const auto& s : zdd){
+        bool isMinimal = true;
+        for(const auto& t : zdd)
+            if(t != s && t.isSubsetOrEqual(s)) isMinimal = false;
+        DOCALC_CHECK(isMinimal == (minimal.count(sorted(s)) == 1));
+    }
+
+    auto costs = HashTable<NodeId, double>();
+    costs.insert(z1, 5.0);
+    costs.insert(z2, 1.0);
+    DOCALC_CHECK(zdd.minCost(costs) == NodeSet({z2}));
+    costs.set(z1, 0.5);
+    DOCALC_CHECK(zdd.minCost(costs) == NodeSet({z1}));
+
+    // every set is drawn, and only sets of the family
+    auto gen = std::mt19937_64(42);
+    auto drawn = std::set<std::vector<NodeId>>();
+    for(int i = 0; i < 300; i++) drawn.insert(sorted(zdd.sample(gen)));
+    DOCALC_CHECK(drawn == expected);
+
+    // the constraints of the search
+    auto required = BackdoorConstraints();
+    required.required.insert(z3);
+    DOCALC_CHECK(backdoor_zdd(bn, x, y, required).count() == 3);
+    auto small = BackdoorConstraints();
+    small.maxSize = 1;
+    DOCALC_CHECK(family(backdoor_zdd(bn, x, y, small)) == minimal);
+
+    const auto copy = BackdoorZDD(zdd);
+    const auto moved = BackdoorZDD(BackdoorZDD(zdd));
+    DOCALC_CHECK(family(copy) == expected && family(moved) == expected);
+}
+
+/// no backdoor path : the empty set (and every superset) is a backdoor set, none without a candidate
+static void testEmptyFamily(){
+    const auto bn = BayesNet<double>::fastPrototype("X->Y");
+    const auto zdd = backdoor_zdd(bn, bn.idFromName("X"), bn.idFromName("Y"));
+    DOCALC_CHECK(zdd.count() == 1);
+    DOCALC_CHECK(family(zdd) == std::set<std::vector<NodeId>>({std::vector<NodeId>()}));
+    DOCALC_CHECK(BackdoorZDD().empty() && BackdoorZDD().count() == 0);
+}
+
+/// the family against the brute force on random graphs : a frontier key merging two prefixes
+/// with different completions would change it
+static void testRandomGraphs(){
+    auto rng = std::mt19937(7);
+    for(int it = 0; it < 300; it++){
+        const auto n = 3 + rng() % 9;
+        auto g = DAG();
+        for(NodeId i = 0; i < n; i++) g.addNodeWithId(i);
+        for(NodeId i = 0; i < n; i++)
+            for(NodeId j = i + 1; j < n; j++)
+                if(rng() % 100 < 35) g.addArc(i, j);
+        const NodeId c = rng() % n;
+        NodeId e;
+        do e = rng() % n; while(e == c);
+
+        const auto desc = g.descendants(c);
+        auto cand = std::vector<NodeId>();
+        for(NodeId i = 0; i < n; i++)
+            if(i != c && i != e && !desc.contains(i)) cand.push_back(i);
+        auto expected = std::set<std::vector<NodeId>>();
+        for(Size m = 0; m < (Size(1) << cand.size()); m++){
+            auto z = NodeSet();
+            for(Size k = 0; k < cand.size(); k++)
+                if((m >> k) & 1) z.insert(cand[k]);
+            if(isDSep_parents(g, NodeSet({c}), NodeSet({e}), z)) expected.insert(sorted(z));
+        }
+        const auto zdd = BackdoorZDD(g, c, e, cand, BackdoorConstraints());
+        DOCALC_CHECK(zdd.count() == expected.size());
+        DOCALC_CHECK(family(zdd) == expected);
+    }
+}
+
+/// K parallel paths X <- a_i <- b_i -> Y : 3^K sets, whose prefixes all have the same completions
+/// once a path is blocked, so the diagram and its construction stay linear in K
+static void testFrontierSharing(){
+    const Size K = 40;
+    auto g = DAG();
+    g.addNodeWithId(0);
+    g.addNodeWithId(1);
+    g.addArc(0, 1);
+    auto cand = std::vector<NodeId>();
+    for(NodeId i = 0; i < K; i++){
+        const NodeId a = 2 + 2 * i, b = 3 + 2 * i;
+        g.addNodeWithId(a);
+        g.addNodeWithId(b);
+        g.addArc(a, 0);
+        g.addArc(b, a);
+        g.addArc(b, 1);
+        cand.push_back(a);
+        cand.push_back(b);
+    }
+    const auto zdd = BackdoorZDD(g, 0, 1, cand, BackdoorConstraints());
+    DOCALC_CHECK(std::abs(zdd.count() / std::pow(3.0, double(K)) - 1.0) < 1e-9);
+    DOCALC_CHECK(zdd.size() <= 4 * K);
+}
+
+int main(){
+    testKnownFamily();
+    testEmptyFamily();
+    testRandomGraphs();
+    testFrontierSharing();
+    return docalcFailures;
+}
@@ -0,0 +1,111 @@
+#include <agrum/BN/BayesNet.h>
+#include <agrum/tools/multidim/instantiation.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "bnLoaders.h"
+#include "testUtils.h"
+
+using namespace gum;
+
+/// the network A -> B, (A, B) -> C with the tables of every format below
+static void checkDescription(const BNDescription& d, const std::vector<std::string>& names, const std::vector<std::string>& aStates){
+    DOCALC_CHECK(d.names == names);
+    DOCALC_CHECK(d.states.size() == 3 && d.states[0] == aStates && d.states[1].size() == 3 && d.states[2].size() == 2);
+    DOCALC_CHECK(d.parents == std::vector<std::vector<Idx>>({{}, {0}, {0, 1}}));
+    DOCALC_CHECK(d.tables[0] == std::vector<double>({0.3, 0.7}));
+    DOCALC_CHECK(d.tables[1] == std::vector<double>({0.1, 0.2, 0.7, 0.3, 0.3, 0.4}));
+    // the variable varies the fastest, then its parents in their order
+    DOCALC_CHECK(d.tables[2] == std::vector<double>({1, 7, 4, 10, 2, 8, 5, 11, 3, 9, 6, 12}));
+}
+
+static const char* const bif = R"(network "n" { property "p"; }
+/* a comment */ variable A { type discrete [ 2 ] { a0, a1 }; property "x"; }
+variable B { type discrete [ 3 ] { b0, b1, b2 }; } // another one
+variable C { type discrete [ 2 ] { c0, c1 }; }
+probability ( A ) { table 0.3, 0.7; }
+probability ( B | A ) { (a0) 0.1, 0.2, 0.7; default 0.3 0.3 0.4; }
+probability ( C | A, B ) { table 1 2 3 4 5 6 7 8 9 10 11 12; }
+)";
+
+static void testParsers(){
+    auto in = std::istringstream(bif);
+    checkDescription(parse_bif(in), {"A", "B", "C"}, {"a0", "a1"});
+
+    // the scope of a function ends with its variable, the last variable of the scope varying the fastest
+    in = std::istringstream("BAYES\n3\n2 3 2\n3\n1 0\n2 0 1\n3 0 1 2\n2\n0.3 0.7\n6\n.1 .2 .7 .3 .3 .4\n12\n1 7 2 8 3 9 4 10 5 11 6 12\n");
+    checkDescription(parse_uai(in), {"X0", "X1", "X2"}, {"0", "1"});
+
+    in = std::istringstream(R"(<?xml version="1.0"?>
+<smile version="1.0" id="N"><!-- a comment -->
+<nodes>
+<cpt id="A"><state id="a0"/><state id='a1' /><probabilities>0.3 0.7</probabilities></cpt>
+<cpt id="B"><state id="b0"/><state id="b1"/><state id="b2"/><parents>A</parents><probabilities>.1 .2 .7 .3 .3 .4</probabilities></cpt>
+<cpt id="C"><state id="c0"/><state id="c1"/><parents>A B</parents><probabilities>1 7 2 8 3 9 4 10 5 11 6 12</probabilities></cpt>
+</nodes><extensions><genie><node id="A"><name>A &amp; b</name></node></genie></extensions></smile>)");
+    checkDescription(parse_xdsl(in), {"A", "B", "C"}, {"a0", "a1"});
+
+    in = std::istringstream("# a comment\nU1: A, B\n\nU2 : B C # another one\n");
+    const auto latents = parse_latents(in);
+    DOCALC_CHECK(latents.size() == 2);
+    DOCALC_CHECK(latents[0].first == "U1" && latents[0].second == std::vector<std::string>({"A", "B"}));
+    DOCALC_CHECK(latents[1].first == "U2" && latents[1].second == std::vector<std::string>({"B", "C"}));
+
+    for(const auto* text : {"variable A { type discrete [ 2 ] { a0 }; }", "variable A { type discrete [ 2 ] { a0, a1 }",
+                            "probability ( A ) { table 0.3, 0.7; }"}){
+        in = std::istringstream(text);
+        bool thrown = false;
+        try{ parse_bif(in); }catch(const IOError&){ thrown = true; }
+        DOCALC_CHECK(thrown);
+    }
+    in = std::istringstream("MARKOV\n1\n2\n1\n1 0\n2\n0.5 0.5\n");
+    bool thrown = false;
+    try{ parse_uai(in); }catch(const IOError&){ thrown = true; }
+    DOCALC_CHECK(thrown);
+}
+
+static void testBuild(){
+    auto in = std::istringstream(bif);
+    const auto bn = build_bn<double>(parse_bif(in));
+    const auto a = bn.idFromName("A"), b = bn.idFromName("B"), c = bn.idFromName("C");
+    DOCALC_CHECK(bn.size() == 3);
+    DOCALC_CHECK(bn.parents(c) == NodeSet({a, b}));
+
+    // C = c1 knowing A = a1 and B = b2, the last value of the table
+    auto inst = Instantiation(bn.cpt(c));
+    inst.chgVal(bn.variable(a), 1);
+    inst.chgVal(bn.variable(b), 2);
+    inst.chgVal(bn.variable(c), 1);
+    DOCALC_CHECK(bn.cpt(c).get(inst) == 12);
+
+    in = std::istringstream("U: A C\n");
+    const auto latents = read_latents(in, bn);
+    DOCALC_CHECK(latents.size() == 1 && latents[0].second == std::vector<NodeId>({a, c}));
+    in = std::istringstream("U: A D\n");
+    bool thrown = false;
+    try{ read_latents(in, bn); }catch(const NotFound&){ thrown = true; }
+    DOCALC_CHECK(thrown);
+
+    // a cycle and a wrong table size are malformed descriptions alike
+    auto cyclic = BNDescription();
+    cyclic.names = {"A", "B"};
+    cyclic.states = {{"0", "1"}, {"0", "1"}};
+    cyclic.parents = {{1}, {0}};
+    cyclic.tables = {{}, {}};
+    thrown = false;
+    try{ build_bn<double>(cyclic); }catch(const InvalidArgument&){ thrown = true; }
+    DOCALC_CHECK(thrown);
+    auto wrongSize = cyclic;
+    wrongSize.parents = {{}, {0}};
+    wrongSize.tables = {{0.5, 0.5}, {0.5, 0.5}};
+    thrown = false;
+    try{ build_bn<double>(wrongSize); }catch(const InvalidArgument&){ thrown = true; }
+    DOCALC_CHECK(thrown);
+}
+
+int main(){
+    testParsers();
+    testBuild();
+    return docalcFailures;
+}
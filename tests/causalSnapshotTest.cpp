@@ -0,0 +1,73 @@
+#include <agrum/BN/BayesNet.h>
+#include <agrum/tools/multidim/instantiation.h>
+#include <filesystem>
+#include <set>
+#include <string>
+
+#include "CausalModel.h"
+#include "causalSnapshot.h"
+#include "testUtils.h"
+
+using namespace gum;
+
+/// names of the parents of ``n`` in ``cm``
+template<typename GUM_SCALAR>
+static std::set<std::string> parentNames(const CausalModel<GUM_SCALAR>& cm, NodeId n){
+    auto res = std::set<std::string>();
+    for(const auto& p : cm.parents(n)) res.insert(cm.variable(p).name());
+    return res;
+}
+
+/// the model U1 -> {A, C}, U2 -> {B, D} over A -> B -> C <- D, with the arcs U1 -> U2 and A -> U2 entering a latent variable
+static void testRoundTrip(){
+    const auto bn = BayesNet<double>::fastPrototype("A->B->C;D->C");
+    auto cm = CausalModel<double>(bn, {{"U1", {bn.idFromName("A"), bn.idFromName("C")}},
+                                       {"U2", {bn.idFromName("B"), bn.idFromName("D")}}});
+    cm.addCausalArc("U1", "U2");
+    cm.addCausalArc("A", "U2");
+
+    const auto path = (std::filesystem::temp_directory_path() / "docalcSnapshotTest.snap").string();
+    write_snapshot(cm, path, true);
+    {
+        const auto snap = CausalSnapshot(path);
+        DOCALC_CHECK(snap.size() == cm.size() && snap.sizeArcs() == cm.sizeArcs());
+        for(const auto& n : cm.nodes()){
+            DOCALC_CHECK(snap.name(n) == cm.variable(n).name());
+            DOCALC_CHECK(snap.domainSize(n) == cm.variable(n).domainSize());
+            auto children = NodeSet();
+            for(const auto& c : snap.children(n)) children.insert(c);
+            DOCALC_CHECK(children == cm.children(n));
+            DOCALC_CHECK(snap.ancestors(n) == cm.ancestors(n));
+        }
+        const auto a = cm.idFromName("A"), b = cm.idFromName("B"), c = cm.idFromName("C"), d = cm.idFromName("D");
+        DOCALC_CHECK(snap.cComponent(a) == snap.cComponent(c) && snap.cComponent(b) == snap.cComponent(d));
+        DOCALC_CHECK(snap.cComponent(a) != snap.cComponent(b));
+        DOCALC_CHECK(snap.cComponent(cm.idFromName("U1")) == snap.bound());
+
+        const auto loaded = load_snapshot<double>(snap);
+        const auto& model = *loaded.model;
+        DOCALC_CHECK(model.size() == cm.size() && model.sizeArcs() == cm.sizeArcs());
+        DOCALC_CHECK(model.latentVariablesIds().size() == 2);
+        for(const auto& n : cm.nodes())
+            DOCALC_CHECK(parentNames(model, model.idFromName(cm.variable(n).name())) == parentNames(cm, n));
+
+        // the tables of the observed variables, read through the names of their variables
+        for(const auto& n : bn.nodes()){
+            const auto& cpt = bn.cpt(n);
+            const auto& other = loaded.bn->cpt(bn.variable(n).name());
+            auto inst = Instantiation(cpt);
+            auto otherInst = Instantiation(other);
+            for(inst.setFirst(); !inst.end(); inst.inc()){
+                for(Idx k = 0; k < cpt.nbrDim(); k++)
+                    otherInst.chgVal(loaded.bn->variableFromName(cpt.variable(k).name()), inst.val(k));
+                DOCALC_CHECK(other.get(otherInst) == cpt.get(inst));
+            }
+        }
+    }
+    std::filesystem::remove(path);
+}
+
+int main(){
+    testRoundTrip();
+    return docalcFailures;
+}
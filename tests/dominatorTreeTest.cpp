@@ -0,0 +1,84 @@
+#include <agrum/tools/graphs/DAG.h>
+#include <random>
+#include <vector>
+
+#include "reachability.h"
+#include "testUtils.h"
+
+using namespace gum;
+
+/// the graph with the arcs ``arcs`` over the nodes 0..n-1
+static DAG graph(Size n, const std::vector<std::pair<NodeId, NodeId>>& arcs){
+    auto g = DAG();
+    for(NodeId i = 0; i < n; i++) g.addNodeWithId(i);
+    for(const auto& [a, b] : arcs) g.addArc(a, b);
+    return g;
+}
+
+/// 0 -> 1 -> {2, 3} -> 4 -> 5, 0 -> 6 -> 5 and 7 unreachable : 1 and 4 split the paths to 4
+static void testKnownTree(){
+    const auto g = graph(8, {{0, 1}, {1, 2}, {1, 3}, {2, 4}, {3, 4}, {4, 5}, {0, 6}, {6, 5}, {7, 5}});
+    const auto dt = DominatorTree(g, 0);
+    DOCALC_CHECK(dt.root() == 0);
+    DOCALC_CHECK(dt.idom(1) == 0 && dt.idom(2) == 1 && dt.idom(3) == 1 && dt.idom(4) == 1);
+    DOCALC_CHECK(dt.idom(5) == 0 && dt.idom(6) == 0);
+    DOCALC_CHECK(dt.dominators(4) == std::vector<NodeId>({0, 1}));
+    DOCALC_CHECK(dt.dominators(5) == std::vector<NodeId>({0}));
+    DOCALC_CHECK(dt.dominators(0).empty());
+    DOCALC_CHECK(dt.dominates(1, 4) && dt.dominates(4, 4) && !dt.dominates(2, 4) && !dt.dominates(1, 5));
+    DOCALC_CHECK(!dt.reachable(7) && dt.dominators(7).empty() && !dt.dominates(0, 7));
+
+    bool thrown = false;
+    try{ dt.idom(0); }catch(const NotFound&){ thrown = true; }
+    DOCALC_CHECK(thrown);
+
+    // the single-node interceptors of the paths 0 -> 4, in the order they are met
+    DOCALC_CHECK(dipath_interceptors(g, 0, 4) == std::vector<NodeId>({1}));
+    DOCALC_CHECK(dipath_interceptors(g, 0, 5).empty());
+    DOCALC_CHECK(dipath_interceptors(g, 7, 4).empty()); // no directed path
+
+    const auto copy = DominatorTree(dt);
+    const auto moved = DominatorTree(DominatorTree(dt));
+    DOCALC_CHECK(copy.idom(4) == 1 && moved.idom(4) == 1);
+}
+
+/// the dominance against its definition on random graphs : ``a`` dominates ``b`` iff ``b``
+/// is not reachable once ``a`` is removed
+static void testRandomGraphs(){
+    auto rng = std::mt19937(3);
+    for(int it = 0; it < 300; it++){
+        const Size n = 2 + rng() % 20;
+        auto g = DAG();
+        for(NodeId i = 0; i < n; i++) g.addNodeWithId(i);
+        const auto density = rng() % 60;
+        for(NodeId i = 0; i < n; i++)
+            for(NodeId j = i + 1; j < n; j++)
+                if(rng() % 100 < density) g.addArc(i, j);
+        const NodeId r = rng() % n;
+        const auto dt = DominatorTree(g, r);
+        const auto reach = g.descendants(r) + NodeSet({r});
+        for(NodeId b = 0; b < n; b++){
+            DOCALC_CHECK(dt.reachable(b) == reach.contains(b));
+            if(!reach.contains(b)) continue;
+            for(NodeId a = 0; a < n; a++){
+                bool expected = a == b || a == r;
+                if(reach.contains(a) && !expected && b != r){
+                    auto h = g;
+                    h.eraseNode(a);
+                    expected = !h.descendants(r).contains(b);
+                }
+                DOCALC_CHECK(dt.dominates(a, b) == expected);
+            }
+            // from the root down to the immediate dominator
+            const auto ds = dt.dominators(b);
+            for(Size k = 1; k < ds.size(); k++) DOCALC_CHECK(dt.dominates(ds[k - 1], ds[k]));
+            if(b != r) DOCALC_CHECK(!ds.empty() && ds.front() == r && ds.back() == dt.idom(b));
+        }
+    }
+}
+
+int main(){
+    testKnownTree();
+    testRandomGraphs();
+    return docalcFailures;
+}
@@ -0,0 +1,106 @@
+#include <agrum/BN/BayesNet.h>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "doorCriteria.h"
+#include "reachability.h"
+#include "testUtils.h"
+
+using namespace gum;
+
+/// 0 -> 1 -> 5, 0 -> 2 -> 5 and 0 -> 3 -> 4 -> 5 : a cut takes 1, 2 and one of 3 and 4
+static void testKnownCut(){
+    auto g = DAG();
+    for(NodeId i = 0; i < 7; i++) g.addNodeWithId(i);
+    for(const auto& [a, b] : std::vector<std::pair<NodeId, NodeId>>({{0, 1}, {1, 5}, {0, 2}, {2, 5}, {0, 3}, {3, 4}, {4, 5}, {6, 0}}))
+        g.addArc(a, b);
+    const auto all = NodeSet({1, 2, 3, 4, 6});
+
+    auto costs = HashTable<NodeId, double>();
+    costs.insert(3, 5.0);
+    DOCALC_CHECK(min_vertex_cut(g, 0, 5, all, costs) == NodeSet({1, 2, 4}));
+    costs.set(3, 0.5);
+    DOCALC_CHECK(min_vertex_cut(g, 0, 5, all, costs) == NodeSet({1, 2, 3}));
+    DOCALC_CHECK(min_vertex_cut(g, 0, 5, all - NodeSet({1}), costs) == std::nullopt);
+    DOCALC_CHECK(min_vertex_cut(g, 0, 6, all, costs) == NodeSet()); // no directed path
+}
+
+/// the cut against the brute force on random graphs
+static void testRandomGraphs(){
+    auto rng = std::mt19937(5);
+    for(int it = 0; it < 300; it++){
+        const Size n = 2 + rng() % 10;
+        auto g = DAG();
+        for(NodeId i = 0; i < n; i++) g.addNodeWithId(i);
+        const auto density = rng() % 60;
+        for(NodeId i = 0; i < n; i++)
+            for(NodeId j = i + 1; j < n; j++)
+                if(rng() % 100 < density) g.addArc(i, j);
+        const NodeId x = rng() % n;
+        NodeId y;
+        do y = rng() % n; while(y == x);
+
+        auto cuttable = NodeSet();
+        auto cand = std::vector<NodeId>();
+        auto costs = HashTable<NodeId, double>();
+        for(NodeId i = 0; i < n; i++){
+            if(i == x || i == y || rng() % 4 == 0) continue;
+            cuttable.insert(i);
+            cand.push_back(i);
+            if(rng() % 2) costs.insert(i, double(1 + rng() % 4));
+        }
+        const auto cost = [&](NodeId v){ return costs.exists(v) ? costs[v] : 1.0; };
+
+        const auto oracle = DipathOracle(g);
+        auto best = std::numeric_limits<double>::infinity();
+        for(Size m = 0; m < (Size(1) << cand.size()); m++){
+            auto z = NodeSet();
+            auto c = 0.0;
+            for(Size k = 0; k < cand.size(); k++)
+                if((m >> k) & 1){
+                    z.insert(cand[k]);
+                    c += cost(cand[k]);
+                }
+            if(!oracle.exists(x, y, z)) best = std::min(best, c);
+        }
+
+        const auto cut = min_vertex_cut(g, x, y, cuttable, costs);
+        DOCALC_CHECK(cut.has_value() == !std::isinf(best));
+        if(!cut) continue;
+        auto c = 0.0;
+        for(const auto& v : *cut) c += cost(v);
+        DOCALC_CHECK(cut->isSubsetOrEqual(cuttable));
+        DOCALC_CHECK(!oracle.exists(x, y, *cut));
+        DOCALC_CHECK(c == best);
+    }
+}
+
+/// the frontdoor sets of X -> Y confounded by U are {M, P} and {N, P}
+static void testMinimumFrontdoor(){
+    const auto bn = BayesNet<double>::fastPrototype("U->X;U->Y;X->M->N->Y;X->P->Y");
+    const auto x = bn.idFromName("X"), y = bn.idFromName("Y");
+    const auto m = bn.idFromName("M"), n = bn.idFromName("N"), p = bn.idFromName("P");
+
+    auto costs = HashTable<NodeId, double>();
+    costs.insert(n, 3.0);
+    DOCALC_CHECK(minimum_frontdoor_set(bn, x, y, costs) == NodeSet({m, p}));
+    costs.set(m, 4.0);
+    DOCALC_CHECK(minimum_frontdoor_set(bn, x, y, costs) == NodeSet({n, p}));
+    DOCALC_CHECK(minimum_frontdoor_set(bn, x, y, costs, NodeSet({p})) == std::nullopt);
+
+    // a set of the generator of minimal cost
+    for(const auto& s : frontdoor_generator(bn, x, y)){
+        auto c = 0.0;
+        for(const auto& v : s) c += costs.exists(v) ? costs[v] : 1.0;
+        DOCALC_CHECK(c >= 4.0);
+    }
+}
+
+int main(){
+    testKnownCut();
+    testRandomGraphs();
+    testMinimumFrontdoor();
+    return docalcFailures;
+}
@@ -0,0 +1,18 @@
+#ifndef DOCALC_TEST_UTILS_H
+#define DOCALC_TEST_UTILS_H
+
+#include <iostream>
+
+/// number of failed checks, the exit code of the test
+static int docalcFailures = 0;
+
+/// checks ``cond``, also in a release build (where assert does nothing)
+#define DOCALC_CHECK(cond)                                                              \
+    do{                                                                                 \
+        if(!(cond)){                                                                    \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #cond << std::endl; \
+            docalcFailures++;                                                           \
+        }                                                                               \
+    }while(false)
+
+#endif